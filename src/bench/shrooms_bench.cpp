@@ -0,0 +1,303 @@
+#include <algorithm>
+#include <chrono>
+#include <cstdint>
+#include <cstdlib>
+#include <fstream>
+#include <functional>
+#include <iostream>
+#include <map>
+#include <sstream>
+#include <string>
+#include <vector>
+
+#include "headless_driver.hpp"
+#include "shrooms_app.hpp"
+#include "systems/render/renderable.hpp"
+#include "world/leaderboard.hpp"
+#include "world/level_loader.hpp"
+#include "world/level_manager.hpp"
+#include "world/menu.hpp"
+#include "world/spawn_governor.hpp"
+#include "world/tutorial.hpp"
+#include "world/vfx.hpp"
+
+// Microbenchmarks for the spawner, VFX and HUD hot paths plus a full headless gameplay minute.
+// Results are written as JSON with one result object per line; `--baseline` compares medians
+// against an earlier results file and exits non-zero on a regression.
+namespace {
+
+struct Options {
+  int samples = 15;
+  double density = 1.0;
+  double gameplay_seconds = 60.0;
+  std::string filter;
+  std::string json_path;
+  std::string baseline_path;
+  double tolerance = 0.15;
+};
+
+void print_usage() {
+  std::cerr << "usage: shrooms_bench [--samples N] [--density X] [--gameplay-seconds S]"
+               " [--filter SUBSTR] [--json PATH] [--baseline PATH] [--tolerance F]"
+            << std::endl;
+}
+
+bool parse_options(int argc, char** argv, Options& options) {
+  for (int i = 1; i < argc; ++i) {
+    const std::string arg = argv[i];
+    const bool has_value = i + 1 < argc;
+    if (arg == "--samples" && has_value) {
+      options.samples = std::atoi(argv[++i]);
+    } else if (arg == "--density" && has_value) {
+      options.density = std::atof(argv[++i]);
+    } else if (arg == "--gameplay-seconds" && has_value) {
+      options.gameplay_seconds = std::atof(argv[++i]);
+    } else if (arg == "--filter" && has_value) {
+      options.filter = argv[++i];
+    } else if (arg == "--json" && has_value) {
+      options.json_path = argv[++i];
+    } else if (arg == "--baseline" && has_value) {
+      options.baseline_path = argv[++i];
+    } else if (arg == "--tolerance" && has_value) {
+      options.tolerance = std::atof(argv[++i]);
+    } else {
+      return false;
+    }
+  }
+  return options.samples > 0 && options.density > 0.0 && options.gameplay_seconds > 0.0 &&
+         options.tolerance >= 0.0;
+}
+
+struct Result {
+  std::string name;
+  uint64_t iterations = 0;
+  double median_ns = 0.0;
+  double min_ns = 0.0;
+  double p95_ns = 0.0;
+};
+
+using Clock = std::chrono::steady_clock;
+
+// Runs `body` `iterations` times per sample; `reset` runs between samples and is not timed.
+Result measure(const std::string& name, uint64_t iterations, int samples,
+               const std::function<void()>& body, const std::function<void()>& reset = {}) {
+  std::vector<double> per_op_ns;
+  per_op_ns.reserve(static_cast<size_t>(samples));
+  for (int sample = 0; sample < samples; ++sample) {
+    if (reset) reset();
+    const auto start = Clock::now();
+    for (uint64_t i = 0; i < iterations; ++i) {
+      body();
+    }
+    const auto end = Clock::now();
+    const double total_ns = std::chrono::duration<double, std::nano>(end - start).count();
+    per_op_ns.push_back(total_ns / static_cast<double>(iterations));
+  }
+  if (reset) reset();
+  std::sort(per_op_ns.begin(), per_op_ns.end());
+  Result result{};
+  result.name = name;
+  result.iterations = iterations * static_cast<uint64_t>(samples);
+  result.min_ns = per_op_ns.front();
+  result.median_ns = per_op_ns[per_op_ns.size() / 2];
+  result.p95_ns = per_op_ns[std::min(per_op_ns.size() - 1, (per_op_ns.size() * 95) / 100)];
+  return result;
+}
+
+constexpr const char* kBenchEntity =
+    "bench_mushroom\n"
+    "texture\nmukhomor\n"
+    "moving\n0 -0.005\n"
+    "rotating\nrandom 0.05 -0.05\n"
+    "layer\n2\n"
+    "collider\nmushroom_catch_handler\n"
+    "collider\nmushroom_fall_handler\n"
+    "collider\nbone_projectile_handler\n"
+    "bench_mushroom\n";
+
+constexpr const char* kWrapText =
+    "Catch the mushrooms from the recipe before they hit the ground. Wrong mushrooms cost a "
+    "life, and your familiar can fetch the ones that are out of reach.";
+
+std::shared_ptr<level_loader::EntityTemplate> bench_spawn_template() {
+  const auto it = level_loader::spawn_templates.find("mukhomor_spawned");
+  if (it != level_loader::spawn_templates.end()) return it->second;
+  return level_loader::spawn_templates.empty() ? nullptr
+                                               : level_loader::spawn_templates.begin()->second;
+}
+
+void write_results(std::ostream& out, const Options& options, const std::vector<Result>& results) {
+  out << "{\"schema\":\"shrooms_bench/1\",\"density\":" << options.density
+      << ",\"samples\":" << options.samples << ",\"results\":[\n";
+  for (size_t i = 0; i < results.size(); ++i) {
+    const auto& r = results[i];
+    out << "{\"name\":\"" << r.name << "\",\"iterations\":" << r.iterations
+        << ",\"median_ns\":" << r.median_ns << ",\"min_ns\":" << r.min_ns
+        << ",\"p95_ns\":" << r.p95_ns << '}' << (i + 1 < results.size() ? "," : "") << '\n';
+  }
+  out << "]}\n";
+}
+
+// Reads the name and median of every result line written by write_results.
+std::map<std::string, double> load_baseline(const std::string& path) {
+  std::map<std::string, double> medians;
+  std::ifstream in(path);
+  if (!in.is_open()) {
+    std::cerr << "shrooms_bench: failed to open baseline " << path << std::endl;
+    return medians;
+  }
+  const std::string name_key = "\"name\":\"";
+  const std::string median_key = "\"median_ns\":";
+  std::string line;
+  while (std::getline(in, line)) {
+    const size_t name_pos = line.find(name_key);
+    const size_t median_pos = line.find(median_key);
+    if (name_pos == std::string::npos || median_pos == std::string::npos) continue;
+    const size_t name_start = name_pos + name_key.size();
+    const size_t name_end = line.find('"', name_start);
+    if (name_end == std::string::npos) continue;
+    medians[line.substr(name_start, name_end - name_start)] =
+        std::atof(line.c_str() + median_pos + median_key.size());
+  }
+  return medians;
+}
+
+}  // namespace
+
+int main(int argc, char** argv) {
+  Options options{};
+  if (!parse_options(argc, argv, options)) {
+    print_usage();
+    return 2;
+  }
+
+  const int view_w = 900;
+  const int view_h = 900;
+  render_system::set_view_size(static_cast<float>(view_w), static_cast<float>(view_h));
+
+  engine::shrooms::set_headless(true);
+  engine::shrooms::ShroomsLogic logic{view_w, view_h};
+  engine::shrooms::HeadlessDriver driver{logic, 1.0 / 60.0};
+  logic.init();
+
+  const auto wanted = [&](const std::string& name) {
+    return options.filter.empty() || name.find(options.filter) != std::string::npos;
+  };
+  // Deleted entities are reclaimed by the next tick.
+  const auto flush = [&] { driver.step(); };
+  std::vector<Result> results;
+
+  if (wanted("level_loader/parse_entity")) {
+    results.push_back(measure(
+        "level_loader/parse_entity", 200, options.samples,
+        [] {
+          std::istringstream in(kBenchEntity);
+          if (auto* entity = level_loader::parse_entity(in)) entity->mark_deleted();
+        },
+        flush));
+  }
+
+  const auto spawn_template = bench_spawn_template();
+  if (spawn_template && wanted("level_loader/spawn_rule")) {
+    const auto rule = level_loader::make_spawn_rule(spawn_template);
+    results.push_back(measure(
+        "level_loader/spawn_rule", 200, options.samples,
+        [&rule] {
+          if (auto* entity = level_loader::run_spawn_rule(rule, glm::vec2{450.0f, 120.0f})) {
+            entity->mark_deleted();
+          }
+        },
+        [&] {
+          vfx::clear_particles();
+          flush();
+        }));
+  }
+
+  if (spawn_template && wanted("vfx/spawn_destroy_effect")) {
+    const auto rule = level_loader::make_spawn_rule(spawn_template);
+    auto* target = level_loader::run_spawn_rule(rule, glm::vec2{430.0f, 400.0f});
+    results.push_back(measure(
+        "vfx/spawn_destroy_effect", 16, options.samples,
+        [target] { vfx::spawn_destroy_effect(target); }, [] { vfx::clear_particles(); }));
+    target->mark_deleted();
+    flush();
+  }
+
+  if (wanted("tutorial/wrap_text_for_view")) {
+    results.push_back(measure("tutorial/wrap_text_for_view", 500, options.samples, [] {
+      const std::string wrapped = tutorial::wrap_text_for_view(kWrapText, 22.0f, 420.0f);
+      if (wrapped.empty()) std::abort();
+    }));
+  }
+
+  if (wanted("menu/update_text")) {
+    uint64_t counter = 0;
+    results.push_back(measure("menu/update_text", 500, options.samples, [&counter] {
+      menu::update_text(menu::status_line, "Infinite run (score " + std::to_string(counter++) +
+                                               ")");
+    }));
+  }
+
+  const std::string bench_date = "2026-01-01";
+  if (wanted("leaderboard/serialize")) {
+    leaderboard::build_default_entries(bench_date);
+    results.push_back(measure("leaderboard/serialize", 1000, options.samples, [&] {
+      if (leaderboard::serialize(bench_date).empty()) std::abort();
+    }));
+  }
+
+  if (wanted("leaderboard/parse")) {
+    leaderboard::build_default_entries(bench_date);
+    const std::string raw = leaderboard::serialize(bench_date);
+    results.push_back(measure("leaderboard/parse", 1000, options.samples, [&] {
+      std::istringstream lines(raw);
+      if (!leaderboard::parse_entry_lines(lines, bench_date)) std::abort();
+    }));
+  }
+
+  if (wanted("gameplay/headless_minute")) {
+    levels::spawn_rate_scale = static_cast<float>(options.density);
+    // Live caps from config.toml would flatten the density knob.
+    const spawn_governor::Config governor = spawn_governor::config;
+    spawn_governor::config.max_live_per_type = 0.0f;
+    spawn_governor::config.max_live_total = 0.0f;
+    const auto ticks = static_cast<uint64_t>(options.gameplay_seconds * 60.0);
+    Result minute = measure(
+        "gameplay/headless_minute", 1, std::max(1, options.samples / 5),
+        [&] {
+          engine::shrooms::start_infinite_run();
+          for (uint64_t tick = 0; tick < ticks; ++tick) {
+            if (engine::shrooms::is_run_over()) engine::shrooms::start_infinite_run();
+            driver.step();
+          }
+        });
+    results.push_back(minute);
+    levels::spawn_rate_scale = 1.0f;
+    spawn_governor::config = governor;
+  }
+
+  write_results(std::cout, options, results);
+  if (!options.json_path.empty()) {
+    std::ofstream out(options.json_path, std::ios::out | std::ios::trunc);
+    if (!out) {
+      std::cerr << "shrooms_bench: failed to open " << options.json_path << std::endl;
+      return 2;
+    }
+    write_results(out, options, results);
+  }
+
+  if (options.baseline_path.empty()) return 0;
+  const auto baseline = load_baseline(options.baseline_path);
+  bool regressed = false;
+  for (const auto& result : results) {
+    const auto it = baseline.find(result.name);
+    if (it == baseline.end() || it->second <= 0.0) continue;
+    const double ratio = result.median_ns / it->second;
+    if (ratio > 1.0 + options.tolerance) {
+      regressed = true;
+      std::cerr << "regression: " << result.name << " median " << result.median_ns
+                << " ns vs baseline " << it->second << " ns (x" << ratio << ")" << std::endl;
+    }
+  }
+  return regressed ? 1 : 0;
+}
@@ -0,0 +1,74 @@
+#pragma once
+
+// Generated by the shrooms_svg_manifest target (src/tools/svg_manifest.cpp); do not edit.
+
+#include <array>
+#include <cstdint>
+#include <string_view>
+
+namespace shrooms::svg_manifest {
+
+struct Entry {
+  std::string_view name;
+  float min_x;
+  float min_y;
+  float width;
+  float height;
+  float aspect;
+  uint32_t file_size;
+  uint32_t hash;
+};
+
+// Sorted by name.
+inline constexpr std::array<Entry, 48> kEntries{{
+    {"background", 10.0104f, 11.1015f, 265.458f, 264.87f, 1.00222f, 6979u, 1762990797u},
+    {"borovik", 238.955f, 123.724f, 26.8307f, 26.3798f, 1.01709f, 1853u, 147022443u},
+    {"borovik_small", 241.085f, 36.9418f, 15.7973f, 15.5318f, 1.01709f, 1415u, 1703906654u},
+    {"bottom_1", 8.52651e-14f, 277.658f, 297.696f, 20.0165f, 14.8725f, 1496u, 3699402826u},
+    {"bottom_2", 5.68434e-14f, 274.319f, 297.696f, 23.3562f, 12.7459f, 1648u, 1573416534u},
+    {"digits_1", -0.005f, -0.005f, 297.69f, 297.685f, 1.00002f, 818u, 2307848955u},
+    {"digits_2", -1.48869f, -0.005f, 299.174f, 297.685f, 1.005f, 922u, 430667279u},
+    {"digits_3", -1.48869f, -0.005f, 299.174f, 297.685f, 1.005f, 948u, 341690820u},
+    {"emoji_crown", 0.0f, 0.0f, 36.0f, 36.0f, 1.0f, 1311u, 2834610656u},
+    {"emoji_fly", 0.0f, 0.0f, 36.0f, 36.0f, 1.0f, 2027u, 3033313337u},
+    {"emoji_frog", 0.0f, 0.0f, 36.0f, 36.0f, 1.0f, 800u, 1318136666u},
+    {"emoji_hedgehog", 0.0f, 0.0f, 36.0f, 36.0f, 1.0f, 4917u, 3320781382u},
+    {"emoji_house", 0.0f, 0.0f, 36.0f, 36.0f, 1.0f, 935u, 4195409927u},
+    {"emoji_infinity", 0.0f, 0.0f, 36.0f, 36.0f, 1.0f, 750u, 2507707528u},
+    {"emoji_lock", 0.0f, 0.0f, 36.0f, 36.0f, 1.0f, 276u, 2417074307u},
+    {"emoji_strawberry", 0.0f, 0.0f, 36.0f, 36.0f, 1.0f, 2157u, 576389544u},
+    {"emoji_tree", 0.0f, 0.0f, 36.0f, 36.0f, 1.0f, 1762u, 473767474u},
+    {"face_mini_1", 5.36913f, 29.4505f, 44.2211f, 24.3669f, 1.8148f, 1951u, 4166723423u},
+    {"face_mini_2", 5.36913f, 29.4505f, 44.2211f, 24.3669f, 1.8148f, 1951u, 2477309853u},
+    {"familiar_attack", 189.449f, 206.106f, 14.2686f, 24.1886f, 0.589889f, 952u, 3517463950u},
+    {"famiriar", 189.848f, 176.325f, 28.5488f, 14.3315f, 1.99203f, 1061u, 1442677700u},
+    {"heart", 41.6212f, 11.1754f, 11.9f, 12.655f, 0.94034f, 804u, 2308901559u},
+    {"icon", -0.005f, -0.005f, 297.69f, 297.685f, 1.00002f, 3583u, 1124960677u},
+    {"level_1_ezh", 5.68434e-14f, 42.4332f, 297.696f, 255.242f, 1.16633f, 3914u, 2087956631u},
+    {"level_2_eli", -0.233014f, 7.49907f, 298.146f, 290.176f, 1.02747f, 4929u, 373078461u},
+    {"level_3_izba", 5.68434e-14f, 31.4154f, 297.696f, 266.265f, 1.11804f, 4008u, 3346190818u},
+    {"level_4_lyaguha", 5.68434e-14f, 11.9853f, 297.696f, 287.482f, 1.03553f, 8009u, 3932880495u},
+    {"level_5_mol", 5.68434e-14f, 34.3613f, 312.404f, 263.314f, 1.18643f, 8687u, 2358786u},
+    {"level_6_tzar", 5.68434e-14f, 21.1462f, 297.696f, 276.534f, 1.07653f, 4241u, 2565054957u},
+    {"level_7_yagoda", 5.68434e-14f, 16.1774f, 297.696f, 281.498f, 1.05754f, 8936u, 3505004062u},
+    {"lisi4ka", 39.3166f, 122.268f, 24.9746f, 24.384f, 1.02422f, 1320u, 2963799399u},
+    {"lisi4ka_small", 241.631f, 60.2847f, 14.7045f, 14.3568f, 1.02422f, 971u, 4002906744u},
+    {"menu_face", 2.13163e-14f, -1.42109e-14f, 67.1578f, 62.6961f, 1.07116f, 945u, 1907323203u},
+    {"menu_pause", 0.68065f, -1.13175f, 297.69f, 298.812f, 0.996245f, 2208u, 3601096298u},
+    {"menu_scoreboard", 233.672f, -7.10543e-15f, 64.241f, 88.0666f, 0.729459f, 918u, 2906498813u},
+    {"mukhomor", 183.594f, 74.8231f, 27.7904f, 25.8343f, 1.07572f, 2278u, 3692277210u},
+    {"mukhomor_small", 240.802f, 13.4251f, 16.3624f, 15.2107f, 1.07572f, 2011u, 2662636950u},
+    {"pause", -17.8782f, -1.13175f, 297.69f, 298.812f, 0.996245f, 2209u, 2127851021u},
+    {"sprite_atlas", 0.0f, 0.0f, 255.755f, 102.357f, 2.49866f, 23008u, 2742076920u},
+    {"witch", 221.442f, 190.656f, 34.647f, 38.959f, 0.88932f, 3200u, 1631363446u},
+    {"witch_fly_left_1", 93.9137f, 219.44f, 61.9697f, 41.1778f, 1.50493f, 3701u, 665280202u},
+    {"witch_fly_left_2", 93.9137f, 219.44f, 61.9697f, 41.1778f, 1.50493f, 3705u, 3844815634u},
+    {"witch_fly_right_1", 93.9137f, 219.44f, 61.9697f, 41.1778f, 1.50493f, 3704u, 3620286625u},
+    {"witch_fly_right_2", 93.9137f, 219.44f, 61.9697f, 41.1778f, 1.50493f, 3703u, 2871192175u},
+    {"witch_left_1", 221.442f, 190.656f, 38.3921f, 38.959f, 0.985449f, 3201u, 3857516598u},
+    {"witch_left_2", 221.442f, 190.656f, 38.3921f, 38.959f, 0.985449f, 3199u, 1864307431u},
+    {"witch_right_1", 217.697f, 190.656f, 38.3921f, 38.959f, 0.985449f, 3207u, 1833029773u},
+    {"witch_right_2", 217.697f, 190.656f, 38.3921f, 38.959f, 0.985449f, 3204u, 2868600796u},
+}};
+
+}  // namespace shrooms::svg_manifest
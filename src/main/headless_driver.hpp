@@ -0,0 +1,116 @@
+#pragma once
+
+#include <algorithm>
+#include <charconv>
+#include <cstddef>
+#include <cstdint>
+#include <fstream>
+#include <iostream>
+#include <sstream>
+#include <string>
+#include <system_error>
+#include <vector>
+
+#include "ecs/driver.hpp"
+#include "engine/input.h"
+
+namespace engine::shrooms {
+
+struct ScriptedInput {
+  uint64_t tick = 0;
+  engine::InputEvent event{};
+};
+
+// Script lines are "<tick> down|up <key>", where <key> is a single character or a key code.
+// Blank lines and lines starting with '#' are ignored.
+inline std::vector<ScriptedInput> load_input_script(const std::string& path) {
+  std::vector<ScriptedInput> script;
+  std::ifstream in(path);
+  if (!in.is_open()) {
+    std::cerr << "Failed to open input script: " << path << std::endl;
+    return script;
+  }
+
+  std::string line;
+  size_t line_number = 0;
+  while (std::getline(in, line)) {
+    ++line_number;
+    if (line.empty() || line[0] == '#') continue;
+    std::istringstream fields(line);
+    ScriptedInput entry{};
+    std::string action;
+    std::string key;
+    if (!(fields >> entry.tick >> action >> key)) continue;
+    if (action != "down" && action != "up") continue;
+    entry.event.kind = action == "down" ? engine::InputKind::KeyDown : engine::InputKind::KeyUp;
+    if (key.size() == 1) {
+      entry.event.key_code = static_cast<unsigned char>(key[0]);
+    } else {
+      // Multi-character keys are numeric key codes; names like "space" are not supported.
+      int code = 0;
+      const auto [end, error] = std::from_chars(key.data(), key.data() + key.size(), code);
+      if (error != std::errc{} || end != key.data() + key.size()) {
+        std::cerr << "Skipping input script line " << line_number << ": bad key '" << key
+                  << "'" << std::endl;
+        continue;
+      }
+      entry.event.key_code = code;
+    }
+    script.push_back(entry);
+  }
+
+  std::stable_sort(script.begin(), script.end(),
+                   [](const ScriptedInput& a, const ScriptedInput& b) { return a.tick < b.tick; });
+  return script;
+}
+
+// Steps an EcsLogic at a fixed dt without a platform or renderer. Frames produced by the
+// logic are discarded.
+class HeadlessDriver {
+ public:
+  HeadlessDriver(ecs::EcsLogic& logic, double dt_seconds)
+      : logic_(logic), dt_seconds_(dt_seconds) {}
+
+  void set_script(std::vector<ScriptedInput> script) {
+    script_ = std::move(script);
+    next_scripted_ = 0;
+  }
+
+  void step() { step(dt_seconds_); }
+
+  // Advances one tick of `dt_seconds`; replays feed their recorded per-tick deltas here.
+  void step(double dt_seconds) {
+    events_.clear();
+    while (next_scripted_ < script_.size() && script_[next_scripted_].tick <= tick_index_) {
+      events_.push_back(script_[next_scripted_].event);
+      ++next_scripted_;
+    }
+
+    engine::AppContext ctx{};
+    ctx.time_seconds = time_seconds_;
+    ctx.delta_seconds = dt_seconds;
+    frame_ = engine::Frame{};
+    logic_.tick(ctx, events_, frame_);
+
+    time_seconds_ += dt_seconds;
+    ++tick_index_;
+  }
+
+  void set_time_seconds(double time_seconds) { time_seconds_ = time_seconds; }
+
+  uint64_t tick_index() const { return tick_index_; }
+  double time_seconds() const { return time_seconds_; }
+  double dt_seconds() const { return dt_seconds_; }
+
+ private:
+  ecs::EcsLogic& logic_;
+  double dt_seconds_ = 1.0 / 60.0;
+  double time_seconds_ = 0.0;
+  uint64_t tick_index_ = 0;
+  std::vector<ScriptedInput> script_{};
+  size_t next_scripted_ = 0;
+  std::vector<engine::InputEvent> events_{};
+  engine::Frame frame_{};
+};
+
+}  // namespace engine::shrooms
@@ -0,0 +1,139 @@
+#include <chrono>
+#include <cstdint>
+#include <cstdlib>
+#include <iostream>
+#include <string>
+#include <utility>
+#include <vector>
+
+#include "headless_driver.hpp"
+#include "shrooms_app.hpp"
+#include "systems/render/renderable.hpp"
+#include "world/replay.hpp"
+
+namespace {
+
+struct Options {
+  int runs = 1;
+  double dt = 1.0 / 60.0;
+  double max_run_seconds = 600.0;
+  std::string script_path;
+  std::string replay_path;
+  std::string schedule_path;
+};
+
+void print_usage() {
+  std::cerr << "usage: shrooms_headless [--runs N] [--dt SECONDS] [--max-run-seconds S]"
+               " [--script PATH] [--replay PATH] [--schedule PATH]"
+            << std::endl;
+}
+
+bool parse_options(int argc, char** argv, Options& options) {
+  for (int i = 1; i < argc; ++i) {
+    const std::string arg = argv[i];
+    const bool has_value = i + 1 < argc;
+    if (arg == "--runs" && has_value) {
+      options.runs = std::atoi(argv[++i]);
+    } else if (arg == "--dt" && has_value) {
+      options.dt = std::atof(argv[++i]);
+    } else if (arg == "--max-run-seconds" && has_value) {
+      options.max_run_seconds = std::atof(argv[++i]);
+    } else if (arg == "--script" && has_value) {
+      options.script_path = argv[++i];
+    } else if (arg == "--replay" && has_value) {
+      options.replay_path = argv[++i];
+    } else if (arg == "--schedule" && has_value) {
+      options.schedule_path = argv[++i];
+    } else {
+      return false;
+    }
+  }
+  return options.runs > 0 && options.dt > 0.0 && options.max_run_seconds > 0.0;
+}
+
+// Plays one recorded run back tick for tick and checks it ends with the recorded score.
+int play_replay(engine::shrooms::ShroomsLogic& logic, engine::shrooms::HeadlessDriver& driver,
+                const std::string& path) {
+  replay::Replay recorded{};
+  if (!replay::load(path, recorded)) return 2;
+
+  std::vector<engine::shrooms::ScriptedInput> script;
+  script.reserve(recorded.events.size());
+  for (const auto& entry : recorded.events) {
+    script.push_back(engine::shrooms::ScriptedInput{entry.tick, entry.event});
+  }
+  driver.set_script(std::move(script));
+  logic.init();
+  if (!engine::shrooms::start_replay_run(recorded)) return 1;
+
+  driver.set_time_seconds(recorded.start_time_seconds);
+  const auto deltas = recorded.tick_deltas();
+  const auto wall_start = std::chrono::steady_clock::now();
+  for (double dt : deltas) {
+    driver.step(dt);
+  }
+  const auto wall_end = std::chrono::steady_clock::now();
+
+  const double wall_seconds = std::chrono::duration<double>(wall_end - wall_start).count();
+  const int score = engine::shrooms::run_score();
+  const bool match = !recorded.finished || score == recorded.score;
+  std::cout << "replay=" << path << " ticks=" << deltas.size() << " score=" << score
+            << " recorded_score=" << recorded.score << " match=" << (match ? 1 : 0)
+            << " wall_seconds=" << wall_seconds << std::endl;
+  return match ? 0 : 1;
+}
+
+}  // namespace
+
+int main(int argc, char** argv) {
+  Options options{};
+  if (!parse_options(argc, argv, options)) {
+    print_usage();
+    return 2;
+  }
+
+  const int view_w = 900;
+  const int view_h = 900;
+  render_system::set_view_size(static_cast<float>(view_w), static_cast<float>(view_h));
+
+  engine::shrooms::set_headless(true);
+  engine::shrooms::ShroomsLogic logic{view_w, view_h};
+  engine::shrooms::HeadlessDriver driver{logic, options.dt};
+  if (!options.replay_path.empty()) {
+    return play_replay(logic, driver, options.replay_path);
+  }
+  if (!options.script_path.empty()) {
+    driver.set_script(engine::shrooms::load_input_script(options.script_path));
+  }
+  logic.init();
+  if (!options.schedule_path.empty()) {
+    uint32_t digest = 0;
+    if (!engine::shrooms::export_daily_schedule(options.schedule_path, digest)) return 1;
+    std::cout << "schedule=" << options.schedule_path << " digest=" << digest << std::endl;
+    return 0;
+  }
+
+  const auto max_run_ticks = static_cast<uint64_t>(options.max_run_seconds / options.dt);
+  const auto wall_start = std::chrono::steady_clock::now();
+  int completed_runs = 0;
+  for (int run = 0; run < options.runs; ++run) {
+    engine::shrooms::start_infinite_run();
+    const uint64_t run_start = driver.tick_index();
+    driver.step();
+    while (!engine::shrooms::is_run_over() && driver.tick_index() - run_start < max_run_ticks) {
+      driver.step();
+    }
+    if (engine::shrooms::is_run_over()) {
+      ++completed_runs;
+    }
+  }
+  const auto wall_end = std::chrono::steady_clock::now();
+
+  const double wall_seconds = std::chrono::duration<double>(wall_end - wall_start).count();
+  const uint64_t ticks = driver.tick_index();
+  std::cout << "runs=" << options.runs << " completed=" << completed_runs << " ticks=" << ticks
+            << " sim_seconds=" << driver.time_seconds() << " wall_seconds=" << wall_seconds
+            << " ticks_per_second=" << (wall_seconds > 0.0 ? ticks / wall_seconds : 0.0)
+            << std::endl;
+  return 0;
+}
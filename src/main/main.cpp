@@ -4,6 +4,7 @@
 #include "shrooms_app.hpp"
 #include "systems/render/renderable.hpp"
 #include "world/visual_constants.hpp"
+#include "world/profiler.hpp"
 
 #ifdef __EMSCRIPTEN__
 #include "engine/platform_emscripten.h"
@@ -73,6 +74,27 @@ EMSCRIPTEN_KEEPALIVE int shrooms_is_shoot_enabled() {
   return engine::shrooms::is_shoot_enabled() ? 1 : 0;
 }
 
+#ifdef SHROOMS_PROFILE
+// Saves the recorded zones as shrooms_trace.json; call from the console via
+// Module._shrooms_profile_download().
+EMSCRIPTEN_KEEPALIVE void shrooms_profile_download() {
+  const std::string trace = profiler::trace_json();
+  EM_ASM(
+      {
+        const json = UTF8ToString($0, $1);
+        const blob = new Blob([json], {type: 'application/json'});
+        const link = document.createElement('a');
+        link.href = URL.createObjectURL(blob);
+        link.download = 'shrooms_trace.json';
+        document.body.appendChild(link);
+        link.click();
+        link.remove();
+        setTimeout(() => URL.revokeObjectURL(link.href), 0);
+      },
+      trace.data(), static_cast<int>(trace.size()));
+}
+#endif
+
 }  // extern "C"
 #endif
 
@@ -14,6 +14,7 @@
 #include "world/score_hud.hpp"
 #include "world/camera_shake.hpp"
 #include "world/ambient_layers.hpp"
+#include "world/broadphase.hpp"
 #include "world/global_fx.hpp"
 #include "world/game_over_sequence.hpp"
 #include "world/level_intro.hpp"
@@ -29,16 +30,32 @@
 #include "world/shrooms_scenes.hpp"
 #include "world/shrooms_screen.hpp"
 #include "world/touchscreen.hpp"
+#include "world/adaptive_quality.hpp"
 #include "world/config_params.hpp"
+#include "world/data_reload.hpp"
+#include "world/telemetry.hpp"
+#include "world/profiler.hpp"
+#include "world/replay.hpp"
+#include "world/sim_clock.hpp"
+#include "world/spawn_governor.hpp"
 
 #include "engine/params_debug_ui.h"
 
+#include <algorithm>
+#include <cstdlib>
+#include <fstream>
+#include <iostream>
+#include <string>
+
 namespace engine::shrooms {
 
 namespace {
 
 bool page_active = true;
 bool gameplay_auto_paused_by_page = false;
+bool headless = false;
+::replay::Recorder replay_recorder{};
+std::string replay_record_path{};
 
 void apply_page_active_state() {
   ::shrooms::audio::set_page_active(page_active);
@@ -67,6 +84,35 @@ void apply_page_active_state() {
   }
 }
 
+::replay::Replay make_replay_header() {
+  ::replay::Replay header{};
+  header.date = ::levels::current_daily_date;
+  header.seed = ::levels::current_daily_seed;
+  header.mode = ::levels::mode_seed_tag();
+  header.bindings.assign(::controls::bindings.begin(), ::controls::bindings.end());
+  header.max_live_per_type = ::spawn_governor::config.max_live_per_type;
+  header.max_live_total = ::spawn_governor::config.max_live_total;
+  return header;
+}
+
+// SHROOMS_RECORD_REPLAY=<path> records every daily infinite run started from the menu.
+void setup_replay_recording() {
+  const char* path = std::getenv("SHROOMS_RECORD_REPLAY");
+  if (!path || !*path) return;
+  replay_record_path = path;
+  ::levels::infinite_run_started_hook = [] { replay_recorder.arm(make_replay_header()); };
+}
+
+void record_replay_tick(const engine::AppContext& ctx,
+                        std::span<const engine::InputEvent> events) {
+  if (!replay_recorder.active()) return;
+  replay_recorder.record_tick(ctx.time_seconds, ctx.delta_seconds, events,
+                              ::sim_clock::accumulator);
+  if (replay_recorder.recording && (is_run_over() || !::levels::infinite_mode)) {
+    replay_recorder.finish(::levels::current_run_score, replay_record_path);
+  }
+}
+
 }  // namespace
 
 ShroomsLogic::ShroomsLogic(int view_width, int view_height)
@@ -103,12 +149,69 @@ void set_mobile_layout(bool enabled) {
   ::controls::set_mobile_layout(enabled);
 }
 
+void set_headless(bool enabled) {
+  headless = enabled;
+}
+
+bool is_headless() {
+  return headless;
+}
+
+void start_infinite_run() {
+  ::menu::start_infinite_from_menu();
+}
+
+bool is_run_over() {
+  return ::levels::level_finished && !::game_over_sequence::is_active();
+}
+
+int run_score() {
+  return ::levels::current_run_score;
+}
+
+bool export_daily_schedule(const std::string& path, uint32_t& digest) {
+  std::ofstream out(path, std::ios::out | std::ios::trunc);
+  if (!out) {
+    std::cerr << "schedule: failed to open " << path << std::endl;
+    return false;
+  }
+  out << ::levels::daily_schedule_csv();
+  digest = ::levels::daily_schedule.digest;
+  return true;
+}
+
+bool start_replay_run(const ::replay::Replay& replay) {
+  ::levels::daily_date_override = replay.date;
+  ::levels::set_game_mode(replay.mode == "recipe" ? ::levels::GameMode::Recipe
+                                                  : ::levels::GameMode::Collector);
+  ::levels::refresh_daily_seed_if_needed();
+  if (::levels::current_daily_seed != replay.seed) {
+    std::cerr << "replay: daily seed " << ::levels::current_daily_seed
+              << " does not match recorded seed " << replay.seed << std::endl;
+    return false;
+  }
+  if (replay.bindings.size() == ::controls::kActionCount) {
+    std::copy(replay.bindings.begin(), replay.bindings.end(), ::controls::bindings.begin());
+  }
+  // The caps hold spawners, so they are part of the run like the bindings.
+  ::spawn_governor::config.max_live_per_type = replay.max_live_per_type;
+  ::spawn_governor::config.max_live_total = replay.max_live_total;
+  start_infinite_run();
+  ::sim_clock::reset();
+  ::sim_clock::accumulator = replay.start_accumulator;
+  return true;
+}
+
 void ShroomsLogic::on_init() {
   ::controls::load();
+  setup_replay_recording();
   config_params::register_params();
   config_params::setup_io();
 
-  ::shrooms::register_shrooms_svg_assets();
+  if (!headless) {
+    ::shrooms::register_shrooms_svg_assets();
+  }
+  ::shrooms::audio::set_backend_enabled(!headless);
   ::shrooms::audio::init();
 
   ::shrooms::screen::set_view(view_width_, view_height_);
@@ -117,6 +220,9 @@ void ShroomsLogic::on_init() {
   scoreboard::init();
   levels::initialize();
   level_loader::load_default();
+  if (!headless) {
+    ::data_reload::init();
+  }
 
   player::init();
   score_hud::init();
@@ -130,13 +236,17 @@ void ShroomsLogic::on_init() {
   menu::init();
   pause_menu::init();
 
+  profiler::init();
   auto* system_entity = arena::create<ecs::Entity>();
-  system_entity->add(arena::create<animation::Animation>());
-  system_entity->add(arena::create<audio_system::AudioSyncSystem>());
-  system_entity->add(arena::create<collision::CollisionSystem>());
-  system_entity->add(arena::create<periodic_spawn::PeriodicSpawnerSystem>());
-  system_entity->add(arena::create<deferred::DeferredSystem>());
-  system_entity->add(arena::create<render_system::RenderSystem>());
+  system_entity->add(profiler::create_system<animation::Animation>("animation"));
+  system_entity->add(profiler::create_system<audio_system::AudioSyncSystem>("audio_sync"));
+  system_entity->add(profiler::create_system<collision::CollisionSystem>("collision"));
+  system_entity->add(profiler::create_system<broadphase::BroadphaseSystem>("broadphase"));
+  system_entity->add(profiler::create_system<spawn_governor::GovernorSystem>("spawn_governor"));
+  system_entity->add(
+      profiler::create_system<periodic_spawn::PeriodicSpawnerSystem>("periodic_spawner"));
+  system_entity->add(profiler::create_system<deferred::DeferredSystem>("deferred"));
+  system_entity->add(profiler::create_system<render_system::RenderSystem>("render"));
 
   if (levels::level_finished) {
     if (::shrooms::scenes::menu) {
@@ -154,12 +264,23 @@ void ShroomsLogic::on_init() {
 void ShroomsLogic::after_tick(const engine::AppContext& ctx,
                               std::span<const engine::InputEvent> events,
                               engine::Frame& frame) {
-  ::global_fx::append_post_process(frame);
+  record_replay_tick(ctx, events);
+  if (headless) {
+    return;
+  }
+  {
+    SHROOMS_PROFILE_ZONE("post_process");
+    ::global_fx::append_post_process(frame);
+  }
+  ::telemetry::on_frame(frame);
+  ::adaptive_quality::on_frame(::telemetry::last_frame_ms());
 #ifndef NDEBUG
   engine::params::poll_source(ctx.time_seconds);
+  ::data_reload::poll(ctx.time_seconds);
   engine::params::debug_ui::update(engine::params::registry(), events, frame.ui,
                                    static_cast<float>(view_width_),
                                    static_cast<float>(view_height_));
+  ::telemetry::update_overlay();
 #endif
   ::shrooms::audio::sync_master_gain();
 }
@@ -1,7 +1,14 @@
 #pragma once
 
+#include <cstdint>
+#include <string>
+
 #include "ecs/driver.hpp"
 
+namespace replay {
+struct Replay;
+}
+
 namespace engine::shrooms {
 
 bool is_gameplay_active();
@@ -10,6 +17,20 @@ int action_key_code(int action_index);
 void set_page_active(bool active);
 void set_touchscreen_enabled(bool enabled);
 void set_mobile_layout(bool enabled);
+// Headless mode skips SVG rasterization, audio output and the post-process passes.
+// Must be set before ShroomsLogic::init().
+void set_headless(bool enabled);
+bool is_headless();
+// Entry points for drivers that bypass the menu, e.g. headless soak runs.
+void start_infinite_run();
+bool is_run_over();
+int run_score();
+// Pins the replay's daily date, mode and bindings and starts its run with the recorded sim clock
+// phase. Returns false when the daily seed no longer matches the recording. Call after init().
+bool start_replay_run(const ::replay::Replay& replay);
+// Writes today's precomputed infinite schedule for the selected mode as CSV and reports its
+// digest. Returns false when the file cannot be written. Call after init().
+bool export_daily_schedule(const std::string& path, uint32_t& digest);
 
 class ShroomsLogic : public ecs::EcsLogic {
  public:
@@ -0,0 +1,155 @@
+#pragma once
+
+#include <algorithm>
+#include <array>
+#include <cmath>
+#include <iostream>
+
+#include "ambient_layers.hpp"
+#include "camera_shake.hpp"
+#include "global_fx.hpp"
+#include "vfx.hpp"
+
+// Trades cosmetic cost for frame time on weak devices. Frame times are averaged over a short
+// window; a slow window steps one tier down, and a sustained run of windows at or under budget
+// steps one tier back up. Vsync hides spare headroom, so stepping up is a probe: if the next
+// window is slow again the hold before the following probe doubles. Tiers are cumulative:
+//   1  glow mask and blur targets at half their configured resolution
+//   2  narrower glow blur
+//   3  half as many ambient spores
+//   4  2x2 destroy shatter instead of 3x3
+//   5  camera shake off
+// The budget is the larger of target_frame_ms and the display's refresh interval, taken as the
+// shortest frame seen over the last few windows, so a 30 Hz vsync is not read as a slow device.
+// The live tier is runtime state, not a param, so autosave never persists it; the telemetry
+// overlay shows it. Nothing here touches gameplay, so tiers never change a run or a replay.
+namespace adaptive_quality {
+
+struct Config {
+  float adaptive = 1.0f;    // 0 = hold `fixed_tier`, 1 = follow frame time; floats for the UI
+  float fixed_tier = 0.0f;  // only used while adaptive is off
+  float target_frame_ms = 16.7f;
+  float step_down_ratio = 1.2f;
+  float step_up_ratio = 1.05f;
+  float window_seconds = 1.5f;
+  float step_up_hold_seconds = 4.0f;
+};
+
+inline Config config{};
+
+inline constexpr int kMaxTier = 5;
+// Longer frames are stalls (tab switches, asset loads), not load.
+inline constexpr float kMaxSampleMs = 250.0f;
+inline constexpr float kMaxBackoff = 8.0f;
+inline constexpr float kBackoffResetSeconds = 30.0f;
+// Refresh intervals longer than this are load, not vsync (covers 30 Hz with jitter).
+inline constexpr float kMaxRefreshMs = 35.0f;
+inline constexpr size_t kRefreshWindows = 8;
+inline constexpr bool kEnableQualityLogging = false;
+
+struct State {
+  int tier = 0;
+  int applied_tier = -1;
+  float window_ms = 0.0f;
+  float window_min_ms = 0.0f;
+  int window_frames = 0;
+  std::array<float, kRefreshWindows> window_mins{};
+  size_t window_mins_next = 0;
+  float refresh_ms = 0.0f;
+  float headroom_seconds = 0.0f;
+  float since_step_up_seconds = kBackoffResetSeconds;
+  float backoff = 1.0f;
+};
+
+inline State state{};
+
+inline int fixed_tier() {
+  return std::clamp(static_cast<int>(std::lround(config.fixed_tier)), 0, kMaxTier);
+}
+
+inline int current_tier() { return config.adaptive < 0.5f ? fixed_tier() : state.tier; }
+
+inline float budget_ms() {
+  return std::max({1.0f, config.target_frame_ms, std::min(state.refresh_ms, kMaxRefreshMs)});
+}
+
+inline void apply(int tier) {
+  if (tier == state.applied_tier) return;
+  state.applied_tier = tier;
+  global_fx::quality.glow_target_divisor = tier >= 1 ? 2 : 1;
+  global_fx::quality.glow_blur_scale = tier >= 2 ? 0.6f : 1.0f;
+  ambient_layers::spawn_period_scale = tier >= 3 ? 2.0f : 1.0f;
+  vfx::shatter_grid = tier >= 4 ? 2 : 3;
+  camera_shake::enabled = tier < 5;
+  if (!camera_shake::enabled) camera_shake::reset();
+  if constexpr (kEnableQualityLogging) {
+    std::cerr << "adaptive_quality: tier " << tier << std::endl;
+  }
+}
+
+inline void reset_window() {
+  state.window_ms = 0.0f;
+  state.window_min_ms = 0.0f;
+  state.window_frames = 0;
+}
+
+// The shortest frame of a window is at least one refresh interval; the smallest of the last few
+// window minimums tracks the interval without following a sustained slow stretch upwards.
+inline void record_window_min(float min_ms) {
+  state.window_mins[state.window_mins_next] = min_ms;
+  state.window_mins_next = (state.window_mins_next + 1) % kRefreshWindows;
+  state.refresh_ms = 0.0f;
+  for (float value : state.window_mins) {
+    if (value <= 0.0f) continue;
+    state.refresh_ms = state.refresh_ms > 0.0f ? std::min(state.refresh_ms, value) : value;
+  }
+}
+
+inline int next_tier(int tier, float mean_ms, float window_seconds) {
+  const float budget = budget_ms();
+  if (mean_ms > budget * config.step_down_ratio) {
+    state.headroom_seconds = 0.0f;
+    if (tier >= kMaxTier) return tier;
+    // The last probe did not fit; wait longer before the next one.
+    if (state.since_step_up_seconds < window_seconds * 2.0f) {
+      state.backoff = std::min(kMaxBackoff, state.backoff * 2.0f);
+    }
+    return tier + 1;
+  }
+  if (mean_ms > budget * config.step_up_ratio || tier == 0) {
+    state.headroom_seconds = 0.0f;
+    return tier;
+  }
+  state.headroom_seconds += window_seconds;
+  if (state.headroom_seconds < config.step_up_hold_seconds * state.backoff) return tier;
+  state.headroom_seconds = 0.0f;
+  state.since_step_up_seconds = 0.0f;
+  return tier - 1;
+}
+
+// Called once per rendered frame with that frame's wall-clock time.
+inline void on_frame(float frame_ms) {
+  if (config.adaptive < 0.5f) {
+    reset_window();
+    apply(current_tier());
+    return;
+  }
+  if (frame_ms > 0.0f && frame_ms <= kMaxSampleMs) {
+    state.window_ms += frame_ms;
+    state.window_min_ms =
+        state.window_frames > 0 ? std::min(state.window_min_ms, frame_ms) : frame_ms;
+    ++state.window_frames;
+    state.since_step_up_seconds += frame_ms * 0.001f;
+    if (state.since_step_up_seconds >= kBackoffResetSeconds) state.backoff = 1.0f;
+  }
+  const float window_seconds = state.window_ms * 0.001f;
+  if (state.window_frames > 0 && window_seconds >= config.window_seconds) {
+    const float mean_ms = state.window_ms / static_cast<float>(state.window_frames);
+    record_window_min(state.window_min_ms);
+    state.tier = next_tier(state.tier, mean_ms, window_seconds);
+    reset_window();
+  }
+  apply(state.tier);
+}
+
+}  // namespace adaptive_quality
@@ -8,14 +8,15 @@
 #include "ecs/ecs.hpp"
 #include "ecs/context.hpp"
 #include "utils/arena.hpp"
-#include "utils/random.hpp"
 #include "systems/dynamic/dynamic_object.hpp"
 #include "systems/render/sprite_system.hpp"
 #include "systems/scene/scene_system.hpp"
 #include "systems/transformation/transform_object.hpp"
 
+#include "rng_streams.hpp"
 #include "shrooms_screen.hpp"
 #include "vfx.hpp"
+#include "profiler.hpp"
 
 namespace ambient_layers {
 
@@ -45,6 +46,9 @@ struct BottomSporeConfig {
   int layer = 0;
 } bottom_config;
 
+// Multiplies both spawn periods; raised by adaptive_quality on slow devices.
+inline float spawn_period_scale = 1.0f;
+
 inline ecs::Entity* bottom_sprite_entity = nullptr;
 
 inline void register_bottom_sprite(ecs::Entity* entity) {
@@ -67,6 +71,7 @@ struct AmbientController : public dynamic::DynamicObject {
   ~AmbientController() override { Component::component_count--; }
 
   void update() override {
+    SHROOMS_PROFILE_ZONE("AmbientController");
     auto* active = scene::get_active_scene();
     if (!active || active->get_name() != "main") {
       return;
@@ -81,28 +86,29 @@ struct AmbientController : public dynamic::DynamicObject {
   }
 
   void update_ambient_spores(float dt) {
+    auto& rng = rng_streams::cosmetic;
     timer -= dt;
     if (timer > 0.0f) return;
 
-    timer = config.spawn_period +
-            static_cast<float>(rnd::get_double(-config.spawn_jitter, config.spawn_jitter));
+    timer = config.spawn_period * spawn_period_scale +
+            static_cast<float>(rng.get_double(-config.spawn_jitter, config.spawn_jitter));
     timer = std::max(0.12f, timer);
 
-    const int count = rnd::get_int(1, 2);
+    const int count = rng.get_int(1, 2);
     for (int i = 0; i < count; ++i) {
-      const float x = static_cast<float>(rnd::get_double(0.0, shrooms::screen::view_width));
-      const float y = static_cast<float>(rnd::get_double(shrooms::screen::view_height * 0.15,
-                                                         shrooms::screen::view_height * 0.9));
+      const float x = static_cast<float>(rng.get_double(0.0, shrooms::screen::view_width));
+      const float y = static_cast<float>(rng.get_double(shrooms::screen::view_height * 0.15,
+                                                        shrooms::screen::view_height * 0.9));
       vfx::SporeConfig spore{};
       spore.color = config.color;
       spore.lifetime =
-          static_cast<float>(rnd::get_double(config.lifetime * 0.75, config.lifetime * 1.2));
+          static_cast<float>(rng.get_double(config.lifetime * 0.75, config.lifetime * 1.2));
       spore.start_radius =
-          static_cast<float>(rnd::get_double(config.min_radius, config.max_radius));
+          static_cast<float>(rng.get_double(config.min_radius, config.max_radius));
       spore.end_radius = spore.start_radius * 2.1f;
       spore.velocity = glm::vec2{
-          static_cast<float>(rnd::get_double(config.min_speed, config.max_speed)),
-          static_cast<float>(rnd::get_double(-18.0, -6.0)),
+          static_cast<float>(rng.get_double(config.min_speed, config.max_speed)),
+          static_cast<float>(rng.get_double(-18.0, -6.0)),
       };
       spore.layer = config.layer;
       vfx::spawn_spore(glm::vec2{x, y}, spore);
@@ -110,6 +116,7 @@ struct AmbientController : public dynamic::DynamicObject {
   }
 
   void update_bottom_spores(float dt) {
+    auto& rng = rng_streams::cosmetic;
     glm::vec2 floor_top_left{0.0f, 0.0f};
     glm::vec2 floor_size{0.0f, 0.0f};
     if (!resolve_bottom_sprite_bounds(floor_top_left, floor_size)) return;
@@ -117,9 +124,9 @@ struct AmbientController : public dynamic::DynamicObject {
     bottom_timer -= dt;
     if (bottom_timer > 0.0f) return;
 
-    bottom_timer = bottom_config.spawn_period +
-                   static_cast<float>(rnd::get_double(-bottom_config.spawn_jitter,
-                                                      bottom_config.spawn_jitter));
+    bottom_timer = bottom_config.spawn_period * spawn_period_scale +
+                   static_cast<float>(rng.get_double(-bottom_config.spawn_jitter,
+                                                     bottom_config.spawn_jitter));
     bottom_timer = std::max(0.12f, bottom_timer);
 
     const auto lifetime_range = std::minmax(bottom_config.min_lifetime, bottom_config.max_lifetime);
@@ -129,21 +136,21 @@ struct AmbientController : public dynamic::DynamicObject {
     const float top_band_height = std::max(1.0f, floor_size.y * top_band_fraction);
 
     const float x = static_cast<float>(
-        rnd::get_double(floor_top_left.x, floor_top_left.x + floor_size.x));
+        rng.get_double(floor_top_left.x, floor_top_left.x + floor_size.x));
     const float y = static_cast<float>(
-        rnd::get_double(floor_top_left.y, floor_top_left.y + top_band_height));
+        rng.get_double(floor_top_left.y, floor_top_left.y + top_band_height));
 
     vfx::SporeConfig spore{};
     spore.color = bottom_config.color;
     spore.lifetime = static_cast<float>(
-        rnd::get_double(lifetime_range.first, lifetime_range.second));
+        rng.get_double(lifetime_range.first, lifetime_range.second));
     spore.start_radius =
-        static_cast<float>(rnd::get_double(radius_range.first, radius_range.second));
+        static_cast<float>(rng.get_double(radius_range.first, radius_range.second));
     spore.end_radius =
-        spore.start_radius * static_cast<float>(rnd::get_double(1.2, 1.8));
+        spore.start_radius * static_cast<float>(rng.get_double(1.2, 1.8));
     spore.velocity = glm::vec2{
-        static_cast<float>(rnd::get_double(-2.0, 2.0)),
-        -static_cast<float>(rnd::get_double(speed_range.first, speed_range.second)),
+        static_cast<float>(rng.get_double(-2.0, 2.0)),
+        -static_cast<float>(rng.get_double(speed_range.first, speed_range.second)),
     };
     spore.layer = bottom_config.layer;
     vfx::spawn_spore(glm::vec2{x, y}, spore);
@@ -0,0 +1,23 @@
+#pragma once
+
+#include <cstddef>
+#include <utility>
+
+#include "utils/arena.hpp"
+
+// arena::create with a running tally. The engine's component counter goes back down when an
+// entity dies, so it reads flat even when every event allocates; the tally only grows. Route
+// gameplay-time creates through here so memory_stats can report them per round.
+namespace arena_tally {
+
+inline size_t allocations = 0;
+inline size_t bytes = 0;
+
+template <typename T, typename... Args>
+T* create(Args&&... args) {
+  ++allocations;
+  bytes += sizeof(T);
+  return arena::create<T>(std::forward<Args>(args)...);
+}
+
+}  // namespace arena_tally
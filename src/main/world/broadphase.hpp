@@ -0,0 +1,186 @@
+#pragma once
+
+#include <algorithm>
+#include <cstdint>
+#include <functional>
+#include <string>
+#include <unordered_map>
+#include <utility>
+#include <vector>
+
+#include "glm/glm/vec2.hpp"
+
+#include "ecs/ecs.hpp"
+#include "systems/dynamic/dynamic_object.hpp"
+#include "systems/scene/scene_system.hpp"
+#include "systems/transformation/transform_object.hpp"
+
+// Game-side collision for the only pairs shrooms cares about: falling mushrooms (bodies)
+// against the player, familiars and the floor (sensors). Bodies are sorted by x once per frame
+// and each sensor scans only the x-window it overlaps, so cost grows with the mushroom count
+// rather than with mushrooms x colliders x triggers. Channels keep the handler names used in
+// mushrooms.data.
+namespace broadphase {
+
+enum Channel : uint32_t {
+  kCatch = 1u << 0,   // mushroom_catch_handler: player and familiar capture
+  kFall = 1u << 1,    // mushroom_fall_handler: floor
+  kStrike = 1u << 2,  // bone_projectile_handler: familiar strike
+};
+
+inline uint32_t channel_for_handler(const std::string& handler_name) {
+  if (handler_name == "mushroom_catch_handler") return kCatch;
+  if (handler_name == "mushroom_fall_handler") return kFall;
+  if (handler_name == "bone_projectile_handler") return kStrike;
+  return 0;
+}
+
+using Callback = std::function<void(ecs::Entity* sensor, ecs::Entity* body)>;
+
+inline std::unordered_map<std::string, Callback>& handlers() {
+  static std::unordered_map<std::string, Callback> registry{};
+  return registry;
+}
+
+struct Registrar {
+  Registrar(const std::string& name, Callback callback) {
+    handlers()[name] = std::move(callback);
+  }
+};
+
+inline Callback handler(const std::string& name) {
+  const auto it = handlers().find(name);
+  return it != handlers().end() ? it->second : Callback{};
+}
+
+struct Body;
+struct Sensor;
+inline std::vector<Body*> bodies{};
+inline std::vector<Sensor*> sensors{};
+
+template <typename T>
+inline void swap_remove(std::vector<T*>& items, T* item) {
+  const auto it = std::find(items.begin(), items.end(), item);
+  if (it == items.end()) return;
+  *it = items.back();
+  items.pop_back();
+}
+
+// Axis-aligned box at the entity's transform position; `channels` is a mask of Channel bits.
+struct Body : public ecs::Component {
+  explicit Body(uint32_t channels) : ecs::Component(), channels(channels) {
+    bodies.push_back(this);
+  }
+  ~Body() override {
+    swap_remove(bodies, this);
+    Component::component_count--;
+  }
+
+  uint32_t channels = 0;
+  glm::vec2 size{0.0f, 0.0f};
+  // Off while the entity is parked in mushroom_pool.
+  bool enabled = true;
+  // Only collides while this scene is the active one.
+  std::string scene{"main"};
+};
+
+// Fires `callback` every frame a body on `channel` overlaps it.
+struct Sensor : public ecs::Component {
+  Sensor(Channel channel, glm::vec2 size, Callback callback)
+      : ecs::Component(), channel(channel), size(size), callback(std::move(callback)) {
+    sensors.push_back(this);
+  }
+  ~Sensor() override {
+    swap_remove(sensors, this);
+    Component::component_count--;
+  }
+
+  Channel channel = kCatch;
+  glm::vec2 size{0.0f, 0.0f};
+  Callback callback{};
+  bool enabled = true;
+  std::string scene{"main"};
+};
+
+struct Box {
+  glm::vec2 min{0.0f, 0.0f};
+  glm::vec2 max{0.0f, 0.0f};
+};
+
+inline bool box_of(ecs::Entity* entity, const glm::vec2& size, Box& out) {
+  if (!entity || entity->is_pending_deletion()) return false;
+  if (size.x <= 0.0f || size.y <= 0.0f) return false;
+  auto* transform = entity->get<transform::TransformObject>();
+  if (!transform) return false;
+  out.min = transform->get_pos();
+  out.max = out.min + size;
+  return true;
+}
+
+struct Proxy {
+  Box box{};
+  Body* body = nullptr;
+};
+
+inline std::vector<Proxy> proxies{};
+inline std::vector<std::pair<Sensor*, ecs::Entity*>> hits{};
+
+inline void build_proxies(const std::string& active_scene, float& max_width) {
+  proxies.clear();
+  max_width = 0.0f;
+  for (auto* body : bodies) {
+    if (!body->enabled || body->scene != active_scene) continue;
+    Proxy proxy{};
+    if (!box_of(body->entity, body->size, proxy.box)) continue;
+    proxy.body = body;
+    max_width = std::max(max_width, body->size.x);
+    proxies.push_back(proxy);
+  }
+  std::sort(proxies.begin(), proxies.end(),
+            [](const Proxy& a, const Proxy& b) { return a.box.min.x < b.box.min.x; });
+}
+
+inline void collect_hits(Sensor* sensor, const Box& area, float max_width) {
+  const auto first = std::lower_bound(
+      proxies.begin(), proxies.end(), area.min.x - max_width,
+      [](const Proxy& proxy, float x) { return proxy.box.min.x < x; });
+  for (auto it = first; it != proxies.end() && it->box.min.x <= area.max.x; ++it) {
+    if (!(it->body->channels & sensor->channel)) continue;
+    if (it->box.max.x < area.min.x) continue;
+    if (it->box.max.y < area.min.y || it->box.min.y > area.max.y) continue;
+    hits.emplace_back(sensor, it->body->entity);
+  }
+}
+
+struct BroadphaseSystem : public dynamic::DynamicObject {
+  BroadphaseSystem() : dynamic::DynamicObject() {}
+  ~BroadphaseSystem() override { Component::component_count--; }
+
+  void update() override {
+    auto* active = scene::get_active_scene();
+    if (!active || scene::is_current_scene_paused()) return;
+    const std::string active_scene = active->get_name();
+
+    float max_width = 0.0f;
+    build_proxies(active_scene, max_width);
+    if (proxies.empty()) return;
+
+    hits.clear();
+    for (auto* sensor : sensors) {
+      if (!sensor->callback || !sensor->enabled || sensor->scene != active_scene) continue;
+      Box area{};
+      if (!box_of(sensor->entity, sensor->size, area)) continue;
+      collect_hits(sensor, area, max_width);
+    }
+
+    // Callbacks may spawn, delete or park entities, so dispatch after the scan and re-check.
+    for (const auto& [sensor, body_entity] : hits) {
+      if (!body_entity || body_entity->is_pending_deletion()) continue;
+      const auto* body = body_entity->get<Body>();
+      if (!body || !body->enabled) continue;
+      sensor->callback(sensor->entity, body_entity);
+    }
+  }
+};
+
+}  // namespace broadphase
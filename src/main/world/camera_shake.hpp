@@ -3,15 +3,18 @@
 #include <algorithm>
 #include <cmath>
 
+#include "glm/glm/vec2.hpp"
+
 #include "ecs/ecs.hpp"
 #include "ecs/context.hpp"
 #include "utils/arena.hpp"
-#include "utils/random.hpp"
 #include "systems/dynamic/dynamic_object.hpp"
+#include "systems/render/render_system.hpp"
 #include "systems/scene/scene_system.hpp"
-#include "systems/transformation/transform_object.hpp"
 
+#include "rng_streams.hpp"
 #include "shrooms_screen.hpp"
+#include "profiler.hpp"
 
 namespace camera_shake {
 
@@ -26,22 +29,22 @@ enum class AxisMode {
   XOnly,
 };
 
-struct ShakeTarget;
-COMPONENT_VECTOR(ShakeTarget, shake_targets);
-
+// Shake is a view offset computed once per frame. ShakeTarget only tags which entities belong
+// to a shaken layer group; their renderables add the offset at emit time, so transforms are
+// never touched and nothing has to be undone when an entity dies mid-shake.
 struct ShakeTarget : public ecs::Component {
   explicit ShakeTarget(AxisMode axis_mode, float strength)
-      : ecs::Component(), axis(axis_mode), strength(strength) {
-    shake_targets.push_back(this);
-  }
+      : ecs::Component(), axis(axis_mode), strength(strength) {}
   ~ShakeTarget() override { Component::component_count--; }
 
   AxisMode axis = AxisMode::Full;
   float strength = 1.0f;
-  glm::vec2 last_offset{0.0f, 0.0f};
-  DETACH_VECTOR(ShakeTarget, shake_targets)
 };
 
+inline glm::vec2 view_offset{0.0f, 0.0f};
+// Cleared by adaptive_quality on its lowest tier; trauma is then ignored.
+inline bool enabled = true;
+
 inline ShakeTarget* attach(ecs::Entity* entity, AxisMode axis = AxisMode::Full,
                            float strength = 1.0f) {
   if (!entity) return nullptr;
@@ -50,37 +53,35 @@ inline ShakeTarget* attach(ecs::Entity* entity, AxisMode axis = AxisMode::Full,
   return target;
 }
 
-inline void clear_offsets() {
-  for (auto* target : shake_targets) {
-    if (!target) continue;
-    auto* entity = target->get_entity();
-    if (!entity || entity->is_pending_deletion()) continue;
-    auto* transform = entity->get<transform::TransformObject>();
-    if (!transform) continue;
-    if (target->last_offset.x != 0.0f || target->last_offset.y != 0.0f) {
-      transform->translate(
-          glm::vec2{-target->last_offset.x, -target->last_offset.y});
-      target->last_offset = glm::vec2{0.0f, 0.0f};
-    }
+inline glm::vec2 offset_for(const ShakeTarget* target) {
+  if (!target) return glm::vec2{0.0f, 0.0f};
+  glm::vec2 applied = view_offset * target->strength;
+  if (target->axis == AxisMode::XOnly) {
+    applied.y = 0.0f;
   }
+  return applied;
 }
 
-inline void apply_offsets(const glm::vec2& offset) {
-  for (auto* target : shake_targets) {
-    if (!target) continue;
-    auto* entity = target->get_entity();
-    if (!entity || entity->is_pending_deletion()) continue;
-    auto* transform = entity->get<transform::TransformObject>();
-    if (!transform) continue;
-    glm::vec2 applied = offset * target->strength;
-    if (target->axis == AxisMode::XOnly) {
-      applied.y = 0.0f;
-    }
-    transform->translate(applied - target->last_offset);
-    target->last_offset = applied;
-  }
+inline glm::vec2 offset_for(ecs::Entity* entity) {
+  if (!entity) return glm::vec2{0.0f, 0.0f};
+  return offset_for(entity->get<ShakeTarget>());
 }
 
+// Wraps a renderable so it is drawn with its entity's shake offset added to the view offset.
+template <typename Base>
+struct Shaken : public Base {
+  using Base::Base;
+
+  void emit(engine::RenderPass& pass) override {
+    const glm::vec2 offset = offset_for(this->entity);
+    render_system::view_offset_x += offset.x;
+    render_system::view_offset_y += offset.y;
+    Base::emit(pass);
+    render_system::view_offset_x -= offset.x;
+    render_system::view_offset_y -= offset.y;
+  }
+};
+
 struct CameraShake : public dynamic::DynamicObject {
   CameraShake() : dynamic::DynamicObject() {}
   ~CameraShake() override { Component::component_count--; }
@@ -90,22 +91,23 @@ struct CameraShake : public dynamic::DynamicObject {
   }
 
   void update() override {
+    SHROOMS_PROFILE_ZONE("CameraShake");
     auto* active = scene::get_active_scene();
     if (!active || active->get_name() != "main") {
       trauma = 0.0f;
-      clear_offsets();
+      view_offset = glm::vec2{0.0f, 0.0f};
       return;
     }
     if (active->is_paused_state()) {
       trauma = 0.0f;
-      clear_offsets();
+      view_offset = glm::vec2{0.0f, 0.0f};
       return;
     }
 
     const float dt = static_cast<float>(ecs::context().delta_seconds);
     trauma = std::max(0.0f, trauma - config.decay * dt);
     if (trauma <= 0.001f) {
-      clear_offsets();
+      view_offset = glm::vec2{0.0f, 0.0f};
       return;
     }
 
@@ -114,7 +116,7 @@ struct CameraShake : public dynamic::DynamicObject {
     const float nx = std::sin(t * config.frequency + phase_x);
     const float ny = std::sin(t * config.frequency * 0.93f + phase_y);
     const float offset = config.max_offset_px * shake;
-    apply_offsets(glm::vec2{nx * offset, ny * offset});
+    view_offset = glm::vec2{nx * offset, ny * offset};
   }
 
   float trauma = 0.0f;
@@ -130,13 +132,13 @@ inline void init() {
 
   auto* entity = arena::create<ecs::Entity>();
   controller = arena::create<CameraShake>();
-  controller->phase_x = static_cast<float>(rnd::get_double(0.0, 6.28318));
-  controller->phase_y = static_cast<float>(rnd::get_double(0.0, 6.28318));
+  controller->phase_x = static_cast<float>(rng_streams::cosmetic.get_double(0.0, 6.28318));
+  controller->phase_y = static_cast<float>(rng_streams::cosmetic.get_double(0.0, 6.28318));
   entity->add(controller);
 }
 
 inline void add_trauma(float amount) {
-  if (!controller) return;
+  if (!controller || !enabled) return;
   controller->add_trauma(amount);
 }
 
@@ -144,7 +146,7 @@ inline void reset() {
   if (controller) {
     controller->trauma = 0.0f;
   }
-  clear_offsets();
+  view_offset = glm::vec2{0.0f, 0.0f};
 }
 
 }  // namespace camera_shake
@@ -4,6 +4,7 @@
 #include "engine/params_glm.h"
 #include "utils/file_system.hpp"
 
+#include "adaptive_quality.hpp"
 #include "ambient_layers.hpp"
 #include "camera_shake.hpp"
 #include "countdown.hpp"
@@ -14,6 +15,8 @@
 #include "pause_menu.hpp"
 #include "round_transition.hpp"
 #include "scoreboard.hpp"
+#include "spawn_governor.hpp"
+#include "telemetry.hpp"
 #include "vfx.hpp"
 
 namespace engine::shrooms::config_params {
@@ -57,6 +60,9 @@ inline void register_params() {
   reg.add(fx, "glow_divide_epsilon", global_fx::config.glow_divide_epsilon)
       .label("Divide Eps")
       .range(0.0f, 1.0f, 0.01f);
+  reg.add(fx, "glow_target_downscale", global_fx::config.glow_target_downscale)
+      .label("Glow Downscale")
+      .range(1.0f, 4.0f, 1.0f);
   reg.add(fx, "shake_pad_px", global_fx::config.shake_pad_px)
       .label("Shake Pad")
       .range(0.0f, 40.0f, 1.0f);
@@ -319,6 +325,51 @@ inline void register_params() {
   reg.add(score_delta_group, "layer", vfx::score_delta_config.layer)
       .label("Layer")
       .range(0.0f, 200.0f, 1.0f);
+
+  auto& governor_group = reg.group("shrooms/spawn_governor");
+  reg.add(governor_group, "max_live_per_type", spawn_governor::config.max_live_per_type)
+      .label("Live Per Type")
+      .range(0.0f, 32.0f, 1.0f);
+  reg.add(governor_group, "max_live_total", spawn_governor::config.max_live_total)
+      .label("Live Total")
+      .range(0.0f, 64.0f, 1.0f);
+  reg.add(governor_group, "max_particles", spawn_governor::config.max_particles)
+      .label("Particles")
+      .range(0.0f, 1408.0f, 16.0f);
+
+  auto& quality_group = reg.group("shrooms/adaptive_quality");
+  reg.add(quality_group, "adaptive", adaptive_quality::config.adaptive)
+      .label("Adaptive")
+      .range(0.0f, 1.0f, 1.0f);
+  reg.add(quality_group, "fixed_tier", adaptive_quality::config.fixed_tier)
+      .label("Fixed Tier")
+      .range(0.0f, static_cast<float>(adaptive_quality::kMaxTier), 1.0f);
+  reg.add(quality_group, "target_frame_ms", adaptive_quality::config.target_frame_ms)
+      .label("Target Frame ms")
+      .range(4.0f, 50.0f, 0.1f);
+  reg.add(quality_group, "step_down_ratio", adaptive_quality::config.step_down_ratio)
+      .label("Step Down Ratio")
+      .range(1.0f, 2.0f, 0.05f);
+  reg.add(quality_group, "step_up_ratio", adaptive_quality::config.step_up_ratio)
+      .label("Step Up Ratio")
+      .range(0.5f, 1.5f, 0.05f);
+  reg.add(quality_group, "window_seconds", adaptive_quality::config.window_seconds)
+      .label("Window")
+      .range(0.25f, 5.0f, 0.25f);
+  reg.add(quality_group, "step_up_hold_seconds", adaptive_quality::config.step_up_hold_seconds)
+      .label("Step Up Hold")
+      .range(1.0f, 30.0f, 0.5f);
+
+  auto& telemetry_group = reg.group("shrooms/telemetry");
+  reg.add(telemetry_group, "overlay", telemetry::config.overlay)
+      .label("Stats Overlay")
+      .range(0.0f, 1.0f, 1.0f);
+  reg.add(telemetry_group, "refresh_seconds", telemetry::config.refresh_seconds)
+      .label("Refresh")
+      .range(0.05f, 2.0f, 0.05f);
+  reg.add(telemetry_group, "csv_interval_seconds", telemetry::config.csv_interval_seconds)
+      .label("CSV Interval")
+      .range(0.1f, 10.0f, 0.1f);
 }
 
 inline void setup_io() {
@@ -0,0 +1,91 @@
+#pragma once
+
+#include <cstdlib>
+#include <filesystem>
+#include <iostream>
+#include <string>
+#include <system_error>
+#include <vector>
+
+#include "level_loader.hpp"
+#include "level_manager.hpp"
+#include "shrooms_assets.hpp"
+
+// Hot reload of levels.data and mushrooms.data while the game runs, polled like config.toml.
+// mushrooms.data changes swap spawner templates in place; levels.data changes rebuild the level
+// list and retune the running level's spawners (see level_loader::reload_spawners and
+// levels::reload_levels). Native debug builds only. SHROOMS_DATA_DIR points the watcher at
+// another directory, e.g. the source assets/ instead of the copy next to the binary. Edits
+// reach levels.pack on the next build.
+namespace data_reload {
+
+inline constexpr double kPollSeconds = 0.5;
+
+struct WatchedFile {
+  std::string path{};
+  std::filesystem::file_time_type stamp{};
+  bool exists = false;
+};
+
+inline WatchedFile levels_file{};
+inline WatchedFile mushrooms_file{};
+inline bool initialized = false;
+inline double last_poll_seconds = 0.0;
+
+inline std::string data_path(const std::string& name) {
+  const char* dir = std::getenv("SHROOMS_DATA_DIR");
+  if (dir && *dir) return std::string(dir) + "/" + name;
+  return shrooms::asset_path(name);
+}
+
+// True when the file's modification time moved since the last call.
+inline bool refresh(WatchedFile& file) {
+  std::error_code error;
+  const auto stamp = std::filesystem::last_write_time(file.path, error);
+  if (error) {
+    file.exists = false;
+    return false;
+  }
+  const bool changed = file.exists && stamp != file.stamp;
+  file.stamp = stamp;
+  file.exists = true;
+  return changed;
+}
+
+inline std::string join(const std::vector<std::string>& values) {
+  std::string out;
+  for (const auto& value : values) {
+    if (!out.empty()) out += ' ';
+    out += value;
+  }
+  return out.empty() ? "none" : out;
+}
+
+inline void init() {
+#ifndef __EMSCRIPTEN__
+  levels_file.path = data_path("levels.data");
+  mushrooms_file.path = data_path("mushrooms.data");
+  refresh(levels_file);
+  refresh(mushrooms_file);
+  initialized = true;
+#endif
+}
+
+inline void poll(double time_seconds) {
+  if (!initialized || time_seconds - last_poll_seconds < kPollSeconds) return;
+  last_poll_seconds = time_seconds;
+  // Spawners first so level plans can name a spawn type added in the same edit.
+  if (refresh(mushrooms_file)) {
+    const auto changed = level_loader::reload_spawners(mushrooms_file.path);
+    std::cerr << "data_reload: " << mushrooms_file.path << " changed spawners: " << join(changed)
+              << std::endl;
+  }
+  if (refresh(levels_file)) {
+    const auto changed = levels::reload_levels(levels_file.path);
+    std::cerr << "data_reload: " << levels_file.path << " reloaded "
+              << levels::parsed_levels.size() << " levels, retuned: " << join(changed)
+              << std::endl;
+  }
+}
+
+}  // namespace data_reload
@@ -0,0 +1,128 @@
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include <functional>
+#include <vector>
+
+#include "ecs/ecs.hpp"
+#include "utils/arena.hpp"
+
+#include "arena_tally.hpp"
+
+// Generational handles for entities that outlive a frame in game bookkeeping (active
+// mushrooms, familiar cargo, tutorial stage targets, deferred spawn reveals). A handle names a
+// slot plus the generation it was issued for; the slot's generation is bumped when the entity
+// is destroyed, so a stale handle reads as empty in O(1) even after the slot, or the entity's
+// memory, has been reused.
+namespace entity_handles {
+
+inline constexpr uint32_t kInvalidIndex = 0xFFFFFFFFu;
+
+struct Slot {
+  ecs::Entity* entity = nullptr;
+  uint32_t generation = 0;
+};
+
+inline std::vector<Slot> slots{};
+inline std::vector<uint32_t> free_slots{};
+
+inline uint32_t acquire_slot(ecs::Entity* entity) {
+  uint32_t index = 0;
+  if (!free_slots.empty()) {
+    index = free_slots.back();
+    free_slots.pop_back();
+  } else {
+    index = static_cast<uint32_t>(slots.size());
+    slots.push_back(Slot{});
+  }
+  slots[index].entity = entity;
+  return index;
+}
+
+inline void release_slot(uint32_t index) {
+  if (index >= slots.size()) return;
+  slots[index].entity = nullptr;
+  slots[index].generation += 1;
+  free_slots.push_back(index);
+}
+
+inline size_t live_slots() { return slots.size() - free_slots.size(); }
+
+// Owns the entity's slot; destroying the entity retires every handle issued for it.
+struct HandleSlot : public ecs::Component {
+  explicit HandleSlot(uint32_t index) : ecs::Component(), index(index) {}
+  ~HandleSlot() override {
+    release_slot(index);
+    Component::component_count--;
+  }
+
+  uint32_t index = kInvalidIndex;
+};
+
+// Retires every handle issued for `entity` without destroying it, for entities that are
+// recycled instead of deleted. Later handles get a fresh slot.
+inline void reissue(ecs::Entity* entity) {
+  if (!entity) return;
+  if (auto* slot = entity->get<HandleSlot>()) {
+    release_slot(slot->index);
+    slot->index = acquire_slot(entity);
+  }
+}
+
+struct Handle {
+  Handle() = default;
+  Handle(std::nullptr_t) {}
+  // Issues a slot for `entity` on first use; later handles to the same entity share it.
+  Handle(ecs::Entity* entity) {
+    if (!entity) return;
+    auto* slot = entity->get<HandleSlot>();
+    if (!slot) {
+      slot = arena_tally::create<HandleSlot>(acquire_slot(entity));
+      entity->add(slot);
+    }
+    index = slot->index;
+    generation = slots[index].generation;
+  }
+
+  // Non-allocating lookup: an empty handle when `entity` was never handed out.
+  static Handle lookup(ecs::Entity* entity) {
+    Handle handle{};
+    if (!entity) return handle;
+    if (auto* slot = entity->get<HandleSlot>()) {
+      handle.index = slot->index;
+      handle.generation = slots[slot->index].generation;
+    }
+    return handle;
+  }
+
+  bool empty() const { return index == kInvalidIndex; }
+
+  // True while the handle still names `entity`, even if it is pending deletion.
+  bool is(const ecs::Entity* entity) const {
+    if (!entity || index >= slots.size()) return false;
+    return slots[index].generation == generation && slots[index].entity == entity;
+  }
+
+  // The live entity, or nullptr once it was destroyed or marked for deletion.
+  ecs::Entity* get() const {
+    if (index >= slots.size() || slots[index].generation != generation) return nullptr;
+    ecs::Entity* entity = slots[index].entity;
+    if (!entity || entity->is_pending_deletion()) return nullptr;
+    return entity;
+  }
+
+  bool operator==(const Handle& other) const = default;
+
+  uint32_t index = kInvalidIndex;
+  uint32_t generation = 0;
+};
+
+struct HandleHash {
+  size_t operator()(const Handle& handle) const {
+    return std::hash<uint64_t>{}((static_cast<uint64_t>(handle.generation) << 32) |
+                                 handle.index);
+  }
+};
+
+}  // namespace entity_handles
@@ -17,6 +17,7 @@
 #include "systems/audio/audio_system.hpp"
 #include "systems/dynamic/dynamic_object.hpp"
 
+#include "rng_streams.hpp"
 #include "shrooms_assets.hpp"
 
 namespace shrooms::audio {
@@ -32,6 +33,8 @@ inline constexpr double kMushroomShotMinGapSeconds = 0.04;
 inline constexpr size_t kCatchSoundCount = 2;
 
 inline bool initialized = false;
+// Cleared by headless builds: every engine::audio call below becomes a no-op.
+inline bool backend_enabled = true;
 inline bool muted = false;
 inline bool page_active = true;
 inline float master_gain_value = kDefaultMasterGain;
@@ -45,7 +48,6 @@ inline engine::SoundId familiar_start_sound_id = engine::kInvalidSoundId;
 inline engine::SoundId familiar_return_sound_id = engine::kInvalidSoundId;
 inline engine::SoundId mushroom_fall_sound_id = engine::kInvalidSoundId;
 inline engine::SoundId mushroom_shot_sound_id = engine::kInvalidSoundId;
-inline std::uint32_t catch_sound_rng = 0x8c2f3a1du;
 
 inline ecs::Entity* bgm_entity = nullptr;
 inline audio_system::AudioObject* bgm_audio = nullptr;
@@ -86,7 +88,12 @@ inline std::array<double, kManagedSoundCount> last_trigger_times{
 
 inline float effective_master_gain() { return muted ? 0.0f : master_gain_value; }
 
-inline void apply_master_gain() { engine::audio::set_master_gain(effective_master_gain()); }
+inline void apply_master_gain() {
+  if (!backend_enabled) return;
+  engine::audio::set_master_gain(effective_master_gain());
+}
+
+inline void set_backend_enabled(bool enabled) { backend_enabled = enabled; }
 
 inline size_t managed_sound_index(ManagedSoundKind kind) {
   return static_cast<size_t>(kind);
@@ -141,7 +148,7 @@ inline engine::SoundId register_and_load_sound(const char* sound_name,
 
 inline ManagedVoice* create_managed_voice(ManagedSoundKind kind, engine::SoundId sound_id,
                                           float initial_gain, float target_gain) {
-  if (sound_id == engine::kInvalidSoundId) return nullptr;
+  if (!backend_enabled || sound_id == engine::kInvalidSoundId) return nullptr;
 
   const engine::audio::VoiceId voice_id = engine::audio::create_voice();
   if (voice_id == engine::audio::kInvalidVoiceId) return nullptr;
@@ -212,8 +219,7 @@ inline bool trigger_allowed(ManagedSoundKind kind, double min_gap_seconds) {
 
 inline size_t next_catch_sound_index(size_t count) {
   if (count == 0) return 0;
-  catch_sound_rng = catch_sound_rng * 1664525u + 1013904223u;
-  return static_cast<size_t>((catch_sound_rng >> 16u) % static_cast<std::uint32_t>(count));
+  return static_cast<size_t>(rng_streams::audio.next_u32() % static_cast<std::uint32_t>(count));
 }
 
 template <size_t N>
@@ -333,6 +339,7 @@ inline void init() {
     return;
   }
   initialized = true;
+  if (!backend_enabled) return;
 
   bgm_sound_id =
       register_and_load_sound("shrooms_bgm_forest_night", "shrooms/audio/bgm/69_forest_night.wav");
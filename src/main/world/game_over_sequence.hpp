@@ -11,7 +11,6 @@
 #include "ecs/ecs.hpp"
 #include "ecs/context.hpp"
 #include "utils/arena.hpp"
-#include "utils/random.hpp"
 #include "systems/color/color_system.hpp"
 #include "systems/dynamic/dynamic_object.hpp"
 #include "systems/hidden/hidden_object.hpp"
@@ -22,6 +21,7 @@
 #include "systems/text/text_object.hpp"
 #include "systems/transformation/transform_object.hpp"
 
+#include "rng_streams.hpp"
 #include "level_manager.hpp"
 #include "shrooms_screen.hpp"
 
@@ -249,8 +249,8 @@ inline void init() {
 
   const float shake_scale = shrooms::screen::scale_to_pixels(glm::vec2{0.02f, 0.0f}).x;
   config.shake_amplitude_px = std::max(config.shake_amplitude_px, shake_scale);
-  phase_x = static_cast<float>(rnd::get_double(0.0, 6.28318));
-  phase_y = static_cast<float>(rnd::get_double(0.0, 6.28318));
+  phase_x = static_cast<float>(rng_streams::cosmetic.get_double(0.0, 6.28318));
+  phase_y = static_cast<float>(rng_streams::cosmetic.get_double(0.0, 6.28318));
 }
 
 }  // namespace game_over_sequence
@@ -36,11 +36,29 @@ struct Config {
   float glow_blur_px = 9.0f;
   float glow_divide_strength = 0.55f;
   float glow_divide_epsilon = 0.2f;
+  float glow_target_downscale = 2.0f;  // 1 = full, 2 = half, 4 = quarter resolution
   float shake_pad_px = 18.0f;
   int tint_layer = 30;
   int glow_layer = -1;
 } config;
 
+// Runtime knobs owned by adaptive_quality, kept apart from the tuned config above.
+struct Quality {
+  int glow_target_divisor = 1;
+  float glow_blur_scale = 1.0f;
+};
+
+inline Quality quality{};
+
+inline constexpr int kMaxGlowTargetDivisor = 8;
+
+// The glow is soft and low-frequency, so its mask and blur run on downscaled targets; the
+// linear-filtered mask is upsampled bilinearly when glow-divide samples it at full size.
+inline int glow_target_divisor() {
+  const int configured = std::max(1, static_cast<int>(std::lround(config.glow_target_downscale)));
+  return std::min(kMaxGlowTargetDivisor, configured * std::max(1, quality.glow_target_divisor));
+}
+
 constexpr engine::RenderTargetId kColorTarget = 0;
 constexpr engine::RenderTargetId kGlowMaskTarget = 1;
 constexpr engine::RenderTargetId kGlowBlurTarget = 2;
@@ -67,7 +85,8 @@ inline ecs::Entity* make_quad(const glm::vec2& pos, const glm::vec2& size,
   transform->pos = pos;
   entity->add(transform);
   entity->add(arena::create<layers::ConstLayer>(layer));
-  entity->add(arena::create<render_system::QuadRenderable>(size.x, size.y, color));
+  entity->add(
+      arena::create<camera_shake::Shaken<render_system::QuadRenderable>>(size.x, size.y, color));
   entity->add(arena::create<scene::SceneObject>("main"));
   camera_shake::attach(entity, camera_shake::AxisMode::Full, 1.35f);
   return entity;
@@ -76,7 +95,8 @@ inline ecs::Entity* make_quad(const glm::vec2& pos, const glm::vec2& size,
 inline glm::vec2 player_center() {
   if (!player::player_transform) return glm::vec2{0.0f, 0.0f};
   return player::player_transform->pos +
-         glm::vec2{player::player_size.x * 0.5f, player::player_size.y * 0.5f};
+         glm::vec2{player::player_size.x * 0.5f, player::player_size.y * 0.5f} +
+         camera_shake::offset_for(player::player_entity);
 }
 
 struct PlayerGlowRenderable : public render_system::QuadRenderable {
@@ -164,16 +184,19 @@ inline void append_post_process(engine::Frame& frame) {
   const int width = shrooms::screen::view_width;
   const int height = shrooms::screen::view_height;
   if (width <= 0 || height <= 0) return;
+  const int divisor = glow_target_divisor();
+  const int glow_width = std::max(1, width / divisor);
+  const int glow_height = std::max(1, height / divisor);
 
   frame.plan.targets.reserve(frame.plan.targets.size() + 3);
   frame.plan.targets.push_back(engine::RenderTargetDesc{
       "shrooms_color", width, height, engine::RenderTargetFormat::RGBA8,
       engine::RenderTargetFilter::Linear});
   frame.plan.targets.push_back(engine::RenderTargetDesc{
-      "shrooms_glow_mask", width, height, engine::RenderTargetFormat::R8,
+      "shrooms_glow_mask", glow_width, glow_height, engine::RenderTargetFormat::R8,
       engine::RenderTargetFilter::Linear});
   frame.plan.targets.push_back(engine::RenderTargetDesc{
-      "shrooms_glow_blur", width, height, engine::RenderTargetFormat::R8,
+      "shrooms_glow_blur", glow_width, glow_height, engine::RenderTargetFormat::R8,
       engine::RenderTargetFilter::Linear});
 
   ensure_post_quad(width, height);
@@ -196,8 +219,11 @@ inline void append_post_process(engine::Frame& frame) {
   frame.plan.passes.insert(frame.plan.passes.begin(), std::move(clear_pass));
   frame.plan.passes.insert(frame.plan.passes.begin(), std::move(clear_mask));
 
-  const engine::Vec2 texel{1.0f / static_cast<float>(width),
-                           1.0f / static_cast<float>(height)};
+  // The blur runs in glow-target texels, so its radius shrinks with the target.
+  const engine::Vec2 texel{1.0f / static_cast<float>(glow_width),
+                           1.0f / static_cast<float>(glow_height)};
+  const float blur_scale =
+      config.glow_blur_px * quality.glow_blur_scale / static_cast<float>(divisor);
 
   engine::RenderPass blur_x{};
   blur_x.name = "glow-blur-x";
@@ -210,7 +236,7 @@ inline void append_post_process(engine::Frame& frame) {
       engine::Uniform{"u_blur_tex", engine::RenderTargetRef{kGlowMaskTarget}});
   blur_x.uniforms.push_back(engine::Uniform{"u_texel", texel});
   blur_x.uniforms.push_back(engine::Uniform{"u_direction", engine::Vec2{1.0f, 0.0f}});
-  blur_x.uniforms.push_back(engine::Uniform{"u_blur_scale", config.glow_blur_px});
+  blur_x.uniforms.push_back(engine::Uniform{"u_blur_scale", blur_scale});
   emit_post_quad(blur_x);
   frame.plan.passes.push_back(std::move(blur_x));
 
@@ -225,7 +251,7 @@ inline void append_post_process(engine::Frame& frame) {
       engine::Uniform{"u_blur_tex", engine::RenderTargetRef{kGlowBlurTarget}});
   blur_y.uniforms.push_back(engine::Uniform{"u_texel", texel});
   blur_y.uniforms.push_back(engine::Uniform{"u_direction", engine::Vec2{0.0f, 1.0f}});
-  blur_y.uniforms.push_back(engine::Uniform{"u_blur_scale", config.glow_blur_px});
+  blur_y.uniforms.push_back(engine::Uniform{"u_blur_scale", blur_scale});
   emit_post_quad(blur_y);
   frame.plan.passes.push_back(std::move(blur_y));
 
@@ -5,15 +5,16 @@
 #include <fstream>
 #include <iostream>
 #include <map>
+#include <memory>
 #include <sstream>
 #include <string>
+#include <unordered_map>
 #include <vector>
 
 #include "glm/glm/vec2.hpp"
 
 #include "ecs/ecs.hpp"
 #include "utils/arena.hpp"
-#include "utils/random.hpp"
 #include "utils/file_system.hpp"
 
 #include "systems/geometry/shapes/quad.hpp"
@@ -27,17 +28,25 @@
 #include "systems/collision/collider_object.hpp"
 #include "systems/spawning/periodic_spawner_system.hpp"
 #include "systems/spawn/periodic_spawner_object.hpp"
-#include "systems/moving/moving_object.hpp"
 #include "systems/rotating/rotating_object.hpp"
 #include "systems/hidden/hidden_object.hpp"
 #include "systems/defer/deferred_system.hpp"
 #include "engine/resource_ids.h"
 #include "systems/scene/scene_object.hpp"
 
+#include "rng_streams.hpp"
+#include "broadphase.hpp"
+#include "entity_handles.hpp"
+#include "mushroom_types.hpp"
 #include "shrooms_assets.hpp"
 #include "shrooms_screen.hpp"
 #include "shrooms_texture_sizing.hpp"
 #include "ambient_layers.hpp"
+#include "arena_tally.hpp"
+#include "level_pack.hpp"
+#include "mushroom_pool.hpp"
+#include "sim_clock.hpp"
+#include "sprite_batch.hpp"
 #include "vfx.hpp"
 
 namespace levels {
@@ -45,60 +54,105 @@ void register_spawner(periodic_spawn::PeriodicSpawnerObject* spawner);
 void register_background_sprite(render_system::SpriteRenderable* sprite,
                                 transform::NoRotationTransform* transform,
                                 const std::string& texture_name);
-void on_mushroom_spawned(const std::string& type, ecs::Entity* entity);
+void on_mushroom_spawned(mushroom_types::MushroomTypeId type, ecs::Entity* entity);
+periodic_spawn::PeriodicSpawnerObject* find_spawner(const std::string& type);
+void apply_source_spawn_period(const std::string& type, float period, double density);
 }  // namespace levels
 
 namespace level_loader {
 
-struct GeometryParseResult {
-  geometry::GeometryObject* geometry = nullptr;
-  glm::vec2 min{0.0f, 0.0f};
-  glm::vec2 max{0.0f, 0.0f};
-};
+struct FloatParam {
+  float value = 0.0f;
+  float random_min = 0.0f;
+  float random_max = 0.0f;
+  bool random = false;
 
-inline constexpr int kSpawnWarningMs = 350;
-inline constexpr bool kEnableSpawnRuleLogging = false;
+  bool operator==(const FloatParam&) const = default;
 
-inline std::string parse_entity_description(std::istream& in) {
-  std::string name;
-  in >> name;
-  std::string res = name;
-  std::string token;
-  while (in >> token) {
-    res = res + ' ' + token;
-    if (token == name) {
-      break;
+  float resolve() const {
+    if (random) {
+      return static_cast<float>(rng_streams::gameplay.get_double(random_min, random_max));
     }
+    return value;
   }
-  return res;
-}
+};
 
-inline GeometryParseResult parse_geometry(std::istream& in, const std::string& name) {
+struct GeometryTemplate {
   std::string type;
-  in >> type;
+  std::vector<glm::vec2> local_points;
+  glm::vec2 min{0.0f, 0.0f};
+  glm::vec2 max{0.0f, 0.0f};
+  bool valid = false;
 
-  int n = 0;
-  if (type == "quad") {
-    n = 4;
-  } else {
-    in >> n;
-  }
+  bool operator==(const GeometryTemplate&) const = default;
+};
 
-#ifndef NDEBUG
-  if (type != "quad" && type != "polygon") {
-    std::fprintf(stderr, "Unknown geometry type '%s' for %s\n", type.c_str(), name.c_str());
-  }
-#endif
+enum class ComponentKind {
+  Geometry,
+  Color,
+  Layer,
+  Moving,
+  Rotating,
+  Collider,
+  Trigger,
+  PeriodicSpawner,
+};
 
-  std::vector<glm::vec2> points;
-  points.reserve(n);
-  for (int i = 0; i < n; ++i) {
-    glm::vec2 p{};
-    in >> p.x >> p.y;
-    points.push_back(shrooms::screen::norm_to_pixels(p));
+struct EntityTemplate;
+
+struct SpawnerTemplate {
+  float period = 0.0f;
+  double density = 0.0;
+  std::shared_ptr<EntityTemplate> entity;
+
+  // Nested templates compare by pointer; spawned mushrooms do not spawn anything themselves.
+  bool operator==(const SpawnerTemplate&) const = default;
+};
+
+// One parsed component of an entity description. Only the fields relevant to `kind` are set.
+struct ComponentTemplate {
+  ComponentKind kind = ComponentKind::Geometry;
+  GeometryTemplate geometry{};
+  glm::vec4 color{1.0f, 1.0f, 1.0f, 1.0f};
+  int layer = 0;
+  glm::vec2 translate_px{0.0f, 0.0f};
+  FloatParam angle{};
+  std::string handler_name;
+  SpawnerTemplate spawner{};
+
+  bool operator==(const ComponentTemplate&) const = default;
+};
+
+// Entity description compiled once at load time. Instantiating it does no text parsing;
+// `random a b` parameters are kept as ranges and rolled per instance.
+struct EntityTemplate {
+  std::string name;
+  std::string texture_name;
+  std::vector<ComponentTemplate> components;
+  int geometry_index = -1;
+
+  bool operator==(const EntityTemplate&) const = default;
+
+  const GeometryTemplate* geometry() const {
+    if (geometry_index < 0) return nullptr;
+    return &components[static_cast<size_t>(geometry_index)].geometry;
   }
+};
+
+inline constexpr int kSpawnWarningMs = 350;
+inline constexpr bool kEnableSpawnRuleLogging = false;
 
-  GeometryParseResult result{};
+// Spawn templates keyed by entity name (e.g. "mukhomor_spawned"), shared with spawn rules.
+inline std::unordered_map<std::string, std::shared_ptr<EntityTemplate>> spawn_templates{};
+// The template each live spawner was built from, keyed by spawn type; compared on hot reload.
+inline std::unordered_map<std::string, SpawnerTemplate> spawner_sources{};
+
+// `points` are already in pixels.
+inline GeometryTemplate make_geometry_template(const std::string& type,
+                                               const std::vector<glm::vec2>& points,
+                                               const std::string& name) {
+  GeometryTemplate result{};
+  result.type = type;
   if (points.empty()) {
     return result;
   }
@@ -130,36 +184,68 @@ inline GeometryParseResult parse_geometry(std::istream& in, const std::string& n
 
   result.min = min;
   result.max = max;
-  if (type == "polygon") {
-    result.geometry = arena::create<geometry::Polygon>(name, local_points);
-  } else if (quad_ok) {
-    result.geometry = arena::create<geometry::Quad>(name, local_points);
-  }
+  result.local_points = std::move(local_points);
+  result.valid = type == "polygon" || quad_ok;
   return result;
 }
 
-inline float parse_float(std::istream& in) {
+inline GeometryTemplate parse_geometry(std::istream& in, const std::string& name) {
+  std::string type;
+  in >> type;
+
+  int n = 0;
+  if (type == "quad") {
+    n = 4;
+  } else {
+    in >> n;
+  }
+
+#ifndef NDEBUG
+  if (type != "quad" && type != "polygon") {
+    std::fprintf(stderr, "Unknown geometry type '%s' for %s\n", type.c_str(), name.c_str());
+  }
+#endif
+
+  std::vector<glm::vec2> points;
+  points.reserve(n);
+  for (int i = 0; i < n; ++i) {
+    glm::vec2 p{};
+    in >> p.x >> p.y;
+    points.push_back(shrooms::screen::norm_to_pixels(p));
+  }
+  return make_geometry_template(type, points, name);
+}
+
+inline geometry::GeometryObject* make_geometry(const GeometryTemplate& geom,
+                                               const std::string& name) {
+  if (!geom.valid) return nullptr;
+  if (geom.type == "polygon") {
+    return arena::create<geometry::Polygon>(name, geom.local_points);
+  }
+  return arena::create<geometry::Quad>(name, geom.local_points);
+}
+
+inline FloatParam parse_float(std::istream& in) {
   std::string token;
   in >> token;
+  FloatParam param{};
   if (token == "random") {
-    float a = 0.0f;
-    float b = 0.0f;
-    in >> a >> b;
-    return static_cast<float>(rnd::get_double(a, b));
+    in >> param.random_min >> param.random_max;
+    param.random = true;
+    return param;
   }
-  return std::stof(token);
+  param.value = std::stof(token);
+  return param;
 }
 
-inline dynamic::MovingObject* parse_moving(std::istream& in) {
-  glm::vec2 point{};
-  in >> point.x >> point.y;
-  glm::vec2 px = shrooms::screen::scale_to_pixels(glm::vec2{point.x, -point.y} * 0.5f);
-  return arena::create<dynamic::MovingObject>(px);
+inline glm::vec2 moving_to_pixels(float x, float y) {
+  return shrooms::screen::scale_to_pixels(glm::vec2{x, -y} * 0.5f);
 }
 
-inline dynamic::RotatingObject* parse_rotating(std::istream& in) {
-  float angle = parse_float(in);
-  return arena::create<dynamic::RotatingObject>(angle);
+inline glm::vec2 parse_moving(std::istream& in) {
+  glm::vec2 point{};
+  in >> point.x >> point.y;
+  return moving_to_pixels(point.x, point.y);
 }
 
 inline std::string parse_texture(std::istream& in) {
@@ -168,198 +254,418 @@ inline std::string parse_texture(std::istream& in) {
   return filepath;
 }
 
-inline layers::LayeredObject* parse_layer(std::istream& in) {
+inline int parse_layer(std::istream& in) {
   int layer_num = 0;
   in >> layer_num;
-  return arena::create<layers::ConstLayer>(layer_num);
+  return layer_num;
 }
 
-inline collision::ColliderObject* parse_collider(std::istream& in) {
+inline std::string parse_handler_name(std::istream& in) {
   std::string handler_name;
   in >> handler_name;
-  return arena::create<collision::ColliderObject>(handler_name);
+  return handler_name;
 }
 
-inline collision::TriggerObject* parse_trigger(std::istream& in) {
-  std::string handler_name;
-  in >> handler_name;
-  auto callback = collision::TriggerCallbackRegistry::get_callback(handler_name);
-  if (!callback) {
-    callback = [](ecs::Entity*, collision::ColliderObject*) {};
-  }
-  return arena::create<collision::TriggerObject>(handler_name, callback);
+inline glm::vec4 color_from_bytes(int r, int g, int b, int a) {
+  return glm::vec4{r / 255.0f, g / 255.0f, b / 255.0f, a / 255.0f};
 }
 
-inline color::ColoredObject* parse_color(std::istream& in) {
+inline glm::vec4 parse_color(std::istream& in) {
   int r = 255;
   int g = 255;
   int b = 255;
   int a = 255;
   in >> r >> g >> b >> a;
-  return arena::create<color::OneColor>(
-      glm::vec4{r / 255.0f, g / 255.0f, b / 255.0f, a / 255.0f});
+  return color_from_bytes(r, g, b, a);
 }
 
-inline std::string extract_texture_name(const std::string& desc) {
-  std::istringstream stream(desc);
-  std::string token;
-  if (!(stream >> token)) {
-    return "";
-  }
-  while (stream >> token) {
-    if (token == "texture") {
-      std::string texture_name;
-      stream >> texture_name;
-      return texture_name;
-    }
+inline collision::TriggerObject* make_trigger(const std::string& handler_name) {
+  auto callback = collision::TriggerCallbackRegistry::get_callback(handler_name);
+  if (!callback) {
+    callback = [](ecs::Entity*, collision::ColliderObject*) {};
   }
-  return "";
+  return arena::create<collision::TriggerObject>(handler_name, callback);
 }
 
-inline ecs::Entity* parse_entity(std::istream& in);
+inline std::shared_ptr<EntityTemplate> compile_entity(std::istream& in);
 
-inline periodic_spawn::PeriodicSpawnerObject* parse_periodic_spawner(std::istream& in) {
-  float period = 0.0f;
-  double density = 0.0;
-  in >> period >> density;
-
-  const std::string desc = parse_entity_description(in);
-  const std::string texture_name = extract_texture_name(desc);
-  LOG_IF(kEnableSpawnRuleLogging,
-         "Spawner parse: period=" << period << " density=" << density
-                                  << " type=" << texture_name << " desc=[" << desc
-                                  << "]");
-  const double scaled_density = density;
-
-  auto* spawner = arena::create<periodic_spawn::PeriodicSpawnerObject>(
-      period,
-      spawn::SpawningRule{
-          scaled_density,
-          [=](glm::vec2 pos) {
-            LOG_IF(kEnableSpawnRuleLogging,
-                   "Spawn rule: type=" << texture_name << " pos=(" << pos.x
-                                       << ", " << pos.y << ")");
-            std::istringstream new_desc(desc);
-            auto* new_entity = parse_entity(new_desc);
-            if (!new_entity) {
-              LOG_IF(kEnableSpawnRuleLogging, "Spawn rule: failed to parse entity desc");
-              return static_cast<ecs::Entity*>(nullptr);
-            }
-
-            const glm::vec2 size =
-                shrooms::texture_sizing::from_reference_width(texture_name, 28.0f);
-            auto* transform = new_entity->get<transform::NoRotationTransform>();
-            if (!transform) {
-              transform = arena::create<transform::NoRotationTransform>();
-              new_entity->add(transform);
-            }
-            transform->pos = shrooms::screen::center_to_top_left(pos, size);
-
-            new_entity->add(arena::create<geometry::Quad>(
-                "spawned_quad",
-                std::vector<glm::vec2>{
-                    glm::vec2{0.0f, 0.0f},
-                    glm::vec2{size.x, 0.0f},
-                    glm::vec2{0.0f, size.y},
-                    glm::vec2{size.x, size.y},
-                }));
-
-            if (!texture_name.empty()) {
-              const engine::TextureId tex_id =
-                  engine::resources::register_texture(texture_name);
-              new_entity->add(arena::create<render_system::SpriteRenderable>(tex_id, size));
-            }
-
-            if (auto* geom = new_entity->get<geometry::GeometryObject>()) {
-              LOG_IF(kEnableSpawnRuleLogging,
-                     "Spawn rule: geometry=" << geom->get_name()
-                                             << " size=" << geom->get_size());
-            } else {
-              LOG_IF(kEnableSpawnRuleLogging, "Spawn rule: missing geometry component");
-            }
-
-            new_entity->add(arena::create<scene::SceneObject>("main"));
-            vfx::spawn_spawn_warning(
-                pos, size, static_cast<float>(kSpawnWarningMs) / 1000.0f);
-
-            auto* hidden = arena::create<hidden::HiddenObject>();
-            hidden->hide();
-            new_entity->add(hidden);
-
-            glm::vec2 original_translate{0.0f, 0.0f};
-            if (auto* moving = new_entity->get<dynamic::MovingObject>()) {
-              original_translate = moving->translate;
-              moving->translate = glm::vec2{0.0f, 0.0f};
-            }
-
-            deferred::fire_deferred(
-                [new_entity, pos, size, original_translate]() {
-                  if (!new_entity || new_entity->is_pending_deletion()) return;
-                  if (auto* hidden = new_entity->get<hidden::HiddenObject>()) {
-                    hidden->show();
-                  }
-                  if (auto* moving = new_entity->get<dynamic::MovingObject>()) {
-                    moving->translate = original_translate;
-                  }
-                  vfx::spawn_spawn_effect(pos, size);
-                },
-                kSpawnWarningMs);
-            levels::on_mushroom_spawned(texture_name, new_entity);
-            return new_entity;
-          }},
-      texture_name);
-
-  spawner->enabled = false;
-  spawner->max_spawn_count = 0;
-  spawner->spawned_count = 0;
-  levels::register_spawner(spawner);
+inline SpawnerTemplate parse_periodic_spawner(std::istream& in) {
+  SpawnerTemplate spawner{};
+  in >> spawner.period >> spawner.density;
+  spawner.entity = compile_entity(in);
+  if (spawner.entity) {
+    spawn_templates[spawner.entity->name] = spawner.entity;
+  }
   return spawner;
 }
 
-inline ecs::Entity* parse_entity(std::istream& in) {
+inline std::shared_ptr<EntityTemplate> compile_entity(std::istream& in) {
   std::string name;
   if (!(in >> name)) return nullptr;
 
-  auto* e = arena::create<ecs::Entity>();
+  auto tmpl = std::make_shared<EntityTemplate>();
+  tmpl->name = name;
   std::string comp;
-  GeometryParseResult geom{};
-  bool has_geometry = false;
-  glm::vec2 size{0.0f, 0.0f};
-  std::string texture_name{};
-  render_system::SpriteRenderable* sprite = nullptr;
-  transform::NoRotationTransform* transform = nullptr;
-
   while (in >> comp) {
     if (comp == name) break;
+    ComponentTemplate component{};
     if (comp == "geometry") {
-      geom = parse_geometry(in, name);
-      if (geom.geometry) {
-        e->add(geom.geometry);
-        has_geometry = true;
-      }
+      component.kind = ComponentKind::Geometry;
+      component.geometry = parse_geometry(in, name);
     } else if (comp == "texture") {
-      texture_name = parse_texture(in);
+      tmpl->texture_name = parse_texture(in);
+      continue;
     } else if (comp == "color") {
-      e->add(parse_color(in));
+      component.kind = ComponentKind::Color;
+      component.color = parse_color(in);
     } else if (comp == "layer") {
-      e->add(parse_layer(in));
+      component.kind = ComponentKind::Layer;
+      component.layer = parse_layer(in);
     } else if (comp == "moving") {
-      e->add(parse_moving(in));
+      component.kind = ComponentKind::Moving;
+      component.translate_px = parse_moving(in);
     } else if (comp == "rotating") {
-      e->add(parse_rotating(in));
+      component.kind = ComponentKind::Rotating;
+      component.angle = parse_float(in);
     } else if (comp == "collider") {
-      e->add(parse_collider(in));
+      component.kind = ComponentKind::Collider;
+      component.handler_name = parse_handler_name(in);
     } else if (comp == "trigger") {
-      e->add(parse_trigger(in));
+      component.kind = ComponentKind::Trigger;
+      component.handler_name = parse_handler_name(in);
     } else if (comp == "periodic_spawner") {
-      e->add(parse_periodic_spawner(in));
+      component.kind = ComponentKind::PeriodicSpawner;
+      component.spawner = parse_periodic_spawner(in);
+    } else {
+      continue;
     }
+    tmpl->components.push_back(std::move(component));
   }
 
-  if (has_geometry) {
-    size = geom.max - geom.min;
-    transform = arena::create<transform::NoRotationTransform>();
-    transform->pos = geom.min;
+  for (size_t i = 0; i < tmpl->components.size(); ++i) {
+    const auto& component = tmpl->components[i];
+    if (component.kind == ComponentKind::Geometry && component.geometry.valid) {
+      tmpl->geometry_index = static_cast<int>(i);
+    }
+  }
+  return tmpl;
+}
+
+// Same templates as compile_entity, built from an entity of the compiled level pack instead of
+// text. `compiled` caches templates by entity index.
+inline std::shared_ptr<EntityTemplate> compile_pack_entity(
+    const level_pack::Pack& pack, uint32_t index,
+    std::vector<std::shared_ptr<EntityTemplate>>& compiled) {
+  if (index >= pack.entities.size()) return nullptr;
+  if (compiled[index]) return compiled[index];
+  const level_pack::Entity& source = pack.entities[index];
+
+  auto tmpl = std::make_shared<EntityTemplate>();
+  compiled[index] = tmpl;
+  tmpl->name = pack.str(source.name);
+  tmpl->texture_name = pack.str(source.texture);
+  tmpl->components.reserve(source.components.size());
+  for (const auto& c : source.components) {
+    ComponentTemplate component{};
+    switch (c.kind) {
+      case level_pack::ComponentKind::Geometry: {
+        component.kind = ComponentKind::Geometry;
+        std::vector<glm::vec2> points;
+        points.reserve(c.points.size() / 2);
+        for (size_t i = 0; i + 1 < c.points.size(); i += 2) {
+          const glm::vec2 norm{c.points[i], c.points[i + 1]};
+          points.push_back(shrooms::screen::norm_to_pixels(norm));
+        }
+        const bool quad = c.geometry_type == level_pack::GeometryType::Quad;
+        component.geometry = make_geometry_template(quad ? "quad" : "polygon", points, tmpl->name);
+        break;
+      }
+      case level_pack::ComponentKind::Color:
+        component.kind = ComponentKind::Color;
+        component.color = color_from_bytes(c.color[0], c.color[1], c.color[2], c.color[3]);
+        break;
+      case level_pack::ComponentKind::Layer:
+        component.kind = ComponentKind::Layer;
+        component.layer = c.layer;
+        break;
+      case level_pack::ComponentKind::Moving:
+        component.kind = ComponentKind::Moving;
+        component.translate_px = moving_to_pixels(c.move_x, c.move_y);
+        break;
+      case level_pack::ComponentKind::Rotating:
+        component.kind = ComponentKind::Rotating;
+        component.angle.random = c.angle_random != 0;
+        component.angle.value = c.angle_value;
+        component.angle.random_min = c.angle_min;
+        component.angle.random_max = c.angle_max;
+        break;
+      case level_pack::ComponentKind::Collider:
+      case level_pack::ComponentKind::Trigger:
+        component.kind = c.kind == level_pack::ComponentKind::Collider ? ComponentKind::Collider
+                                                                       : ComponentKind::Trigger;
+        component.handler_name = pack.str(c.handler);
+        break;
+      case level_pack::ComponentKind::PeriodicSpawner:
+        component.kind = ComponentKind::PeriodicSpawner;
+        component.spawner.period = c.spawner_period;
+        component.spawner.density = c.spawner_density;
+        component.spawner.entity = compile_pack_entity(pack, c.spawner_entity, compiled);
+        if (component.spawner.entity) {
+          spawn_templates[component.spawner.entity->name] = component.spawner.entity;
+        }
+        break;
+    }
+    tmpl->components.push_back(std::move(component));
+  }
+
+  for (size_t i = 0; i < tmpl->components.size(); ++i) {
+    const auto& component = tmpl->components[i];
+    if (component.kind == ComponentKind::Geometry && component.geometry.valid) {
+      tmpl->geometry_index = static_cast<int>(i);
+    }
+  }
+  return tmpl;
+}
+
+inline ecs::Entity* instantiate(const EntityTemplate& tmpl);
+
+// Everything a spawner's rule needs, resolved once when the spawner is built.
+struct SpawnRule {
+  std::shared_ptr<EntityTemplate> tmpl{};
+  std::string texture_name{};
+  mushroom_types::MushroomTypeId type_id = mushroom_types::kNoType;
+  glm::vec2 size{0.0f, 0.0f};
+  engine::TextureId tex_id = engine::kInvalidTextureId;
+  std::vector<glm::vec2> quad_points{};
+};
+
+inline SpawnRule make_spawn_rule(const std::shared_ptr<EntityTemplate>& tmpl) {
+  SpawnRule rule{};
+  rule.tmpl = tmpl;
+  rule.texture_name = tmpl ? tmpl->texture_name : "";
+  rule.type_id = mushroom_types::intern(rule.texture_name);
+  rule.size = shrooms::texture_sizing::from_reference_width(rule.texture_name, 28.0f);
+  rule.tex_id = rule.texture_name.empty()
+                    ? engine::kInvalidTextureId
+                    : engine::resources::register_texture(rule.texture_name);
+  rule.quad_points = {
+      glm::vec2{0.0f, 0.0f},
+      glm::vec2{rule.size.x, 0.0f},
+      glm::vec2{0.0f, rule.size.y},
+      glm::vec2{rule.size.x, rule.size.y},
+  };
+  return rule;
+}
+
+// First life of a spawned mushroom: the components a template alone does not give it.
+inline void dress_spawned(const SpawnRule& rule, ecs::Entity* entity) {
+  if (!entity->get<transform::NoRotationTransform>()) {
+    entity->add(arena_tally::create<transform::NoRotationTransform>());
+  }
+  entity->add(arena_tally::create<geometry::Quad>("spawned_quad", rule.quad_points));
+  if (auto* body = entity->get<broadphase::Body>()) {
+    body->size = rule.size;
+  }
+
+  if (rule.tex_id != engine::kInvalidTextureId) {
+    entity->add(arena_tally::create<sprite_batch::BatchedSprite>(rule.tex_id, rule.size));
+  }
+
+  if (auto* geom = entity->get<geometry::GeometryObject>()) {
+    LOG_IF(kEnableSpawnRuleLogging,
+           "Spawn rule: geometry=" << geom->get_name() << " size=" << geom->get_size());
+  } else {
+    LOG_IF(kEnableSpawnRuleLogging, "Spawn rule: missing geometry component");
+  }
+
+  entity->add(arena_tally::create<scene::SceneObject>("main"));
+  entity->add(arena_tally::create<mushroom_types::MushroomType>(rule.type_id));
+  entity->add(arena_tally::create<hidden::HiddenObject>());
+  mushroom_pool::adopt(entity, rule.tmpl);
+}
+
+inline float spawned_wobble_speed() {
+  return static_cast<float>(rng_streams::gameplay.get_double(1.4, 2.4));
+}
+
+// Later lives: undoes what the catch and miss effects changed and re-rolls the template's
+// random values, then the wobble speed and phase, so the gameplay stream sees the same draws in
+// the same order instantiate() would have made.
+inline void recycle_spawned(const SpawnRule& rule, ecs::Entity* entity) {
+  vfx::unlock_mushroom_vfx(entity);
+  if (auto* tint = entity->get<color::OneColor>()) {
+    tint->color = glm::vec4{1.0f, 1.0f, 1.0f, 1.0f};
+  }
+  for (const auto& component : rule.tmpl->components) {
+    switch (component.kind) {
+      case ComponentKind::Color:
+        if (auto* tint = entity->get<color::OneColor>()) tint->color = component.color;
+        break;
+      case ComponentKind::Layer:
+        if (auto* layer = entity->get<layers::ConstLayer>()) layer->layer = component.layer;
+        break;
+      case ComponentKind::Moving:
+        if (auto* moving = entity->get<sim_clock::FixedStepMover>()) {
+          moving->translate = component.translate_px;
+        }
+        break;
+      case ComponentKind::Rotating: {
+        const float angle = component.angle.resolve();
+        if (auto* rotating = entity->get<dynamic::RotatingObject>()) rotating->angle = angle;
+        break;
+      }
+      default:
+        break;
+    }
+  }
+  if (auto* sprite = entity->get<render_system::SpriteRenderable>()) {
+    sprite->size = rule.size;
+  }
+  if (entity->get<vfx::WobbleOffset>()) {
+    vfx::restart_wobble(entity, spawned_wobble_speed());
+  }
+}
+
+// Spawns one mushroom at `pos` (its center): hidden behind a spawn warning, revealed after
+// kSpawnWarningMs. Reuses a parked mushroom of the same template when the pool has one.
+inline ecs::Entity* run_spawn_rule(const SpawnRule& rule, glm::vec2 pos) {
+  LOG_IF(kEnableSpawnRuleLogging,
+         "Spawn rule: type=" << rule.texture_name << " pos=(" << pos.x << ", " << pos.y << ")");
+  if (!rule.tmpl) {
+    LOG_IF(kEnableSpawnRuleLogging, "Spawn rule: missing entity template");
+    return nullptr;
+  }
+  ecs::Entity* new_entity = mushroom_pool::acquire(rule.tmpl.get());
+  if (new_entity) {
+    recycle_spawned(rule, new_entity);
+  } else {
+    new_entity = instantiate(*rule.tmpl);
+    dress_spawned(rule, new_entity);
+  }
+
+  if (auto* transform = new_entity->get<transform::NoRotationTransform>()) {
+    transform->pos = shrooms::screen::center_to_top_left(pos, rule.size);
+  }
+  vfx::spawn_spawn_warning(pos, rule.size, static_cast<float>(kSpawnWarningMs) / 1000.0f);
+
+  if (auto* hidden = new_entity->get<hidden::HiddenObject>()) {
+    hidden->hide();
+  }
+
+  glm::vec2 original_translate{0.0f, 0.0f};
+  if (auto* moving = new_entity->get<sim_clock::FixedStepMover>()) {
+    original_translate = moving->translate;
+    moving->translate = glm::vec2{0.0f, 0.0f};
+  }
+
+  deferred::fire_deferred(
+      [handle = entity_handles::Handle(new_entity), pos, size = rule.size, original_translate]() {
+        auto* new_entity = handle.get();
+        if (!new_entity) return;
+        if (auto* hidden = new_entity->get<hidden::HiddenObject>()) {
+          hidden->show();
+        }
+        if (auto* moving = new_entity->get<sim_clock::FixedStepMover>()) {
+          moving->translate = original_translate;
+        }
+        vfx::spawn_spawn_effect(pos, size);
+      },
+      kSpawnWarningMs);
+  levels::on_mushroom_spawned(rule.type_id, new_entity);
+  return new_entity;
+}
+
+inline spawn::SpawningRule make_spawning_rule(const SpawnerTemplate& spawner_tmpl) {
+  return spawn::SpawningRule{
+      spawner_tmpl.density,
+      [rule = make_spawn_rule(spawner_tmpl.entity)](glm::vec2 pos) {
+        return run_spawn_rule(rule, pos);
+      }};
+}
+
+inline periodic_spawn::PeriodicSpawnerObject* make_periodic_spawner(
+    const SpawnerTemplate& spawner_tmpl) {
+  const std::shared_ptr<EntityTemplate> tmpl = spawner_tmpl.entity;
+  const std::string texture_name = tmpl ? tmpl->texture_name : "";
+  LOG_IF(kEnableSpawnRuleLogging,
+         "Spawner parse: period=" << spawner_tmpl.period << " density=" << spawner_tmpl.density
+                                  << " type=" << texture_name << " template="
+                                  << (tmpl ? tmpl->name : ""));
+
+  auto* spawner = arena::create<periodic_spawn::PeriodicSpawnerObject>(
+      spawner_tmpl.period, make_spawning_rule(spawner_tmpl), texture_name);
+  spawner_sources[texture_name] = spawner_tmpl;
+
+  spawner->enabled = false;
+  spawner->max_spawn_count = 0;
+  spawner->spawned_count = 0;
+  levels::register_spawner(spawner);
+  return spawner;
+}
+
+inline ecs::Entity* instantiate(const EntityTemplate& tmpl) {
+  const std::string& name = tmpl.name;
+  auto* e = arena_tally::create<ecs::Entity>();
+  bool has_geometry = false;
+  glm::vec2 size{0.0f, 0.0f};
+  render_system::SpriteRenderable* sprite = nullptr;
+  transform::NoRotationTransform* transform = nullptr;
+  uint32_t body_channels = 0;
+  broadphase::Sensor* sensor = nullptr;
+
+  for (const auto& component : tmpl.components) {
+    switch (component.kind) {
+      case ComponentKind::Geometry:
+        if (auto* geom = make_geometry(component.geometry, name)) {
+          e->add(geom);
+          has_geometry = true;
+        }
+        break;
+      case ComponentKind::Color:
+        e->add(arena_tally::create<color::OneColor>(component.color));
+        break;
+      case ComponentKind::Layer:
+        e->add(arena_tally::create<layers::ConstLayer>(component.layer));
+        break;
+      case ComponentKind::Moving:
+        e->add(arena_tally::create<sim_clock::FixedStepMover>(component.translate_px));
+        break;
+      case ComponentKind::Rotating:
+        e->add(arena_tally::create<dynamic::RotatingObject>(component.angle.resolve()));
+        break;
+      case ComponentKind::Collider:
+        if (const uint32_t channel = broadphase::channel_for_handler(component.handler_name)) {
+          body_channels |= channel;
+        } else {
+          e->add(arena_tally::create<collision::ColliderObject>(component.handler_name));
+        }
+        break;
+      case ComponentKind::Trigger:
+        if (const uint32_t channel = broadphase::channel_for_handler(component.handler_name)) {
+          sensor = arena_tally::create<broadphase::Sensor>(
+              static_cast<broadphase::Channel>(channel), glm::vec2{0.0f, 0.0f},
+              broadphase::handler(component.handler_name));
+          e->add(sensor);
+        } else {
+          e->add(make_trigger(component.handler_name));
+        }
+        break;
+      case ComponentKind::PeriodicSpawner:
+        e->add(make_periodic_spawner(component.spawner));
+        break;
+    }
+  }
+
+  if (body_channels != 0) {
+    e->add(arena_tally::create<broadphase::Body>(body_channels));
+  }
+
+  const GeometryTemplate* geom = tmpl.geometry();
+  const std::string& texture_name = tmpl.texture_name;
+  if (has_geometry && geom) {
+    size = geom->max - geom->min;
+    transform = arena_tally::create<transform::NoRotationTransform>();
+    transform->pos = geom->min;
     e->add(transform);
 
     if (!texture_name.empty()) {
@@ -373,15 +679,22 @@ inline ecs::Entity* parse_entity(std::istream& in) {
       }
       const engine::TextureId tex_id =
           engine::resources::register_texture(texture_name);
-      sprite = arena::create<render_system::SpriteRenderable>(tex_id, size);
+      sprite = arena_tally::create<render_system::SpriteRenderable>(tex_id, size);
       e->add(sprite);
     } else if (auto* colored = e->get<color::ColoredObject>()) {
       const auto c = colored->get_color();
-      e->add(arena::create<render_system::QuadRenderable>(
+      e->add(arena_tally::create<render_system::QuadRenderable>(
           size.x, size.y, engine::UIColor{c.x, c.y, c.z, c.w}));
     }
   }
 
+  if (auto* body = e->get<broadphase::Body>()) {
+    body->size = size;
+  }
+  if (sensor) {
+    sensor->size = size;
+  }
+
   if (has_geometry) {
     if (name == "background") {
       const glm::vec2 amplitude{
@@ -398,18 +711,23 @@ inline ecs::Entity* parse_entity(std::istream& in) {
       std::map<std::string, std::vector<animation::SpriteFrame>> clips{};
       clips["idle"] = {animation::SpriteFrame{frame_1, 0.25f},
                        animation::SpriteFrame{frame_2, 0.25f}};
-      e->add(arena::create<animation::SpriteAnimation>(std::move(clips), "idle"));
+      e->add(arena_tally::create<animation::SpriteAnimation>(std::move(clips), "idle"));
       ambient_layers::register_bottom_sprite(e);
     } else if (name.find("_spawned") != std::string::npos) {
       const glm::vec2 amplitude{size.x * 0.06f, size.y * 0.05f};
-      const float speed = static_cast<float>(rnd::get_double(1.4, 2.4));
-      vfx::attach_wobble(e, amplitude, speed);
+      vfx::attach_wobble(e, amplitude, spawned_wobble_speed());
     }
   }
 
   return e;
 }
 
+inline ecs::Entity* parse_entity(std::istream& in) {
+  auto tmpl = compile_entity(in);
+  if (!tmpl) return nullptr;
+  return instantiate(*tmpl);
+}
+
 inline std::vector<ecs::Entity*> parse(std::istream& in) {
   std::vector<ecs::Entity*> res;
   ecs::Entity* e = nullptr;
@@ -434,7 +752,94 @@ inline std::vector<ecs::Entity*> load(const std::string& filename) {
   return entities;
 }
 
+// Instantiates the top-level entities of a compiled level pack, in file order.
+inline std::vector<ecs::Entity*> load_pack(const level_pack::Pack& pack) {
+  std::vector<std::shared_ptr<EntityTemplate>> compiled(pack.entities.size());
+  std::vector<ecs::Entity*> entities;
+  for (uint32_t i = 0; i < pack.entities.size(); ++i) {
+    if (!pack.entities[i].root) continue;
+    auto tmpl = compile_pack_entity(pack, i, compiled);
+    auto* e = tmpl ? instantiate(*tmpl) : nullptr;
+    if (!e) continue;
+    e->add(arena::create<scene::SceneObject>("main"));
+    entities.push_back(e);
+  }
+  return entities;
+}
+
+// Whether the spawn rule built from `a` is still valid for `b`; the period is not part of it.
+inline bool same_spawner_source(const SpawnerTemplate& a, const SpawnerTemplate& b) {
+  if (a.density != b.density) return false;
+  if (!a.entity || !b.entity) return a.entity == b.entity;
+  return *a.entity == *b.entity;
+}
+
+// Hot reload of mushrooms.data. Only spawners are reloaded: one whose template or density
+// changed gets a new rule in place, one whose period changed is reconfigured, a new spawn type
+// gets a spawner entity of its own, and unchanged spawners keep their template. Mushrooms
+// already on screen are left alone. The background, sky and floor entities are not rebuilt.
+// Returns the spawn types that changed.
+inline std::vector<std::string> reload_spawners(const std::string& filename) {
+  std::ifstream in(filename);
+  if (!in.is_open()) {
+    std::cerr << "Failed to open level config: " << filename << std::endl;
+    return {};
+  }
+  const auto previous_templates = spawn_templates;
+  std::vector<SpawnerTemplate> reloaded;
+  while (auto tmpl = compile_entity(in)) {
+    for (const auto& component : tmpl->components) {
+      if (component.kind == ComponentKind::PeriodicSpawner && component.spawner.entity) {
+        reloaded.push_back(component.spawner);
+      }
+    }
+  }
+
+  std::vector<std::string> changed;
+  bool rebuilt = false;
+  for (const auto& spawner_tmpl : reloaded) {
+    const std::string& type = spawner_tmpl.entity->texture_name;
+    auto* spawner = levels::find_spawner(type);
+    const auto source = spawner_sources.find(type);
+    if (spawner && source != spawner_sources.end() &&
+        same_spawner_source(source->second, spawner_tmpl)) {
+      const auto kept = previous_templates.find(spawner_tmpl.entity->name);
+      if (kept != previous_templates.end()) spawn_templates[kept->first] = kept->second;
+      if (source->second.period == spawner_tmpl.period) continue;
+      source->second.period = spawner_tmpl.period;
+      levels::apply_source_spawn_period(type, spawner_tmpl.period, spawner_tmpl.density);
+      changed.push_back(type);
+      continue;
+    }
+    if (spawner) {
+      const bool new_period =
+          source == spawner_sources.end() || source->second.period != spawner_tmpl.period;
+      spawner->rule = make_spawning_rule(spawner_tmpl);
+      spawner_sources[type] = spawner_tmpl;
+      if (new_period) {
+        levels::apply_source_spawn_period(type, spawner_tmpl.period, spawner_tmpl.density);
+      }
+    } else {
+      auto* e = arena::create<ecs::Entity>();
+      e->add(make_periodic_spawner(spawner_tmpl));
+      e->add(arena::create<scene::SceneObject>("main"));
+    }
+    changed.push_back(type);
+    rebuilt = true;
+  }
+  // A period-only change keeps the templates, so parked mushrooms stay reusable.
+  if (rebuilt) mushroom_pool::clear();
+  return changed;
+}
+
+// Prefers assets/levels.pack; falls back to the text file when the pack is missing, invalid or
+// stale.
 inline std::vector<ecs::Entity*> load_default() {
+  if (const auto* pack = level_pack::load_cached(shrooms::asset_path("levels.pack"),
+                                                 shrooms::asset_path("levels.data"),
+                                                 shrooms::asset_path("mushrooms.data"))) {
+    return load_pack(*pack);
+  }
   return load(shrooms::asset_path("mushrooms.data"));
 }
 
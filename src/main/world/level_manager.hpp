@@ -2,6 +2,7 @@
 
 #include <algorithm>
 #include <cstdint>
+#include <cstring>
 #include <fstream>
 #include <functional>
 #include <iostream>
@@ -25,6 +26,11 @@
 #include "systems/defer/deferred_system.hpp"
 #include "utils/save_system.hpp"
 
+#include "rng_streams.hpp"
+#include "entity_handles.hpp"
+#include "memory_stats.hpp"
+#include "mushroom_pool.hpp"
+#include "mushroom_types.hpp"
 #include "scoreboard.hpp"
 #include "score_hud.hpp"
 #include "shrooms_assets.hpp"
@@ -34,11 +40,13 @@
 #include "engine/geometry_builder.h"
 #include "engine/resource_ids.h"
 #include "systems/render/sprite_system.hpp"
+#include "spawn_governor.hpp"
 #include "vfx.hpp"
 #include "camera_shake.hpp"
 #include "round_transition.hpp"
 #include "level_intro.hpp"
 #include "leaderboard.hpp"
+#include "level_pack.hpp"
 #include "daily_runtime.hpp"
 
 namespace levels {
@@ -61,10 +69,13 @@ struct SpawnerPlan {
   int total_to_spawn = 0;
 };
 
+inline constexpr int kNotInRecipe = -1;
+
 struct LevelDefinition {
   std::string id;
   std::vector<std::pair<std::string, int>> recipe_order;
-  std::unordered_map<std::string, int> recipe;
+  // Target count per interned type; kNotInRecipe for types the level does not ask for.
+  mushroom_types::PerType<int> recipe{kNotInRecipe};
   std::vector<SpawnerPlan> spawners;
   ObjectiveRule objective_rule = ObjectiveRule::CollectOnly;
   std::string objective_hint;
@@ -105,9 +116,17 @@ struct InfiniteCollectorTicket {
 inline std::vector<LevelDefinition> parsed_levels{};
 inline std::vector<LevelDefinition> base_levels{};
 inline std::unordered_map<std::string, periodic_spawn::PeriodicSpawnerObject*> spawners_by_type{};
-inline std::unordered_map<std::string, std::unordered_set<ecs::Entity*>> active_entities{};
-inline std::unordered_map<std::string, int> collected_counts{};
-inline std::unordered_map<std::string, int> sorted_counts{};
+// The same spawners with their type interned once at registration, for per-tick loops.
+struct TypedSpawner {
+  periodic_spawn::PeriodicSpawnerObject* spawner = nullptr;
+  mushroom_types::MushroomTypeId type = mushroom_types::kNoType;
+};
+inline std::vector<TypedSpawner> typed_spawners{};
+inline mushroom_types::PerType<
+    std::unordered_set<entity_handles::Handle, entity_handles::HandleHash>>
+    active_entities{};
+inline mushroom_types::PerType<int> collected_counts{};
+inline mushroom_types::PerType<int> sorted_counts{};
 inline size_t current_level_index = 0;
 inline size_t unlocked_level_count = 0;
 inline size_t last_played_level_index = 0;
@@ -135,11 +154,17 @@ inline LevelDefinition tutorial_level{};
 inline bool progress_save_exists = false;
 inline std::unordered_map<std::string, SpawnerPlan> base_spawner_plans{};
 inline std::vector<std::string> infinite_types{};
+// Bumped whenever base_spawner_plans is rebuilt, so the daily schedule knows to follow.
+inline uint32_t base_plans_version = 0;
 inline render_system::SpriteRenderable* background_sprite = nullptr;
 inline transform::NoRotationTransform* background_transform = nullptr;
 inline GameMode current_game_mode = GameMode::Collector;
 inline std::string current_daily_date{};
 inline uint32_t current_daily_seed = 0;
+// Pins the daily date (YYYY-MM-DD) instead of the local calendar; used by replay playback.
+inline std::string daily_date_override{};
+// Multiplies every spawner's rate (divides its period); benchmarks use it to vary density.
+inline float spawn_rate_scale = 1.0f;
 inline std::vector<InfiniteCollectorTicket> infinite_collector_queue{};
 inline uint32_t infinite_collector_ticket_index = 0;
 inline constexpr size_t kInfiniteCollectorMinQueue = 3;
@@ -154,6 +179,8 @@ inline TutorialSpawnHook tutorial_spawn_hook{};
 inline TutorialCatchHook tutorial_catch_hook{};
 inline TutorialMissHook tutorial_miss_hook{};
 inline TutorialSortHook tutorial_sort_hook{};
+// Fires after an infinite run has been set up, before its first tick.
+inline std::function<void()> infinite_run_started_hook{};
 
 constexpr const char* kLegacyProgressKey = "shrooms_progress";
 constexpr const char* kSelectedModeKey = "shrooms_selected_mode";
@@ -272,16 +299,20 @@ inline size_t unlocked_levels() { return unlocked_level_count; }
 
 inline bool has_progress_save() { return progress_save_exists; }
 
-inline int progress_for_type(const LevelDefinition& level, const std::string& type) {
+inline int progress_for_type(const LevelDefinition& level, mushroom_types::MushroomTypeId type) {
   switch (level.objective_rule) {
     case ObjectiveRule::SortOnly:
-      return sorted_counts[type];
+      return sorted_counts.get(type);
     case ObjectiveRule::CollectOnly:
     default:
-      return collected_counts[type];
+      return collected_counts.get(type);
   }
 }
 
+inline int progress_for_type(const LevelDefinition& level, const std::string& type) {
+  return progress_for_type(level, mushroom_types::intern(type));
+}
+
 inline std::string objective_line_text(const LevelDefinition& level, const std::string& type,
                                        int target) {
   if (!level.objective_hint.empty()) {
@@ -325,23 +356,30 @@ inline void register_background_sprite(render_system::SpriteRenderable* sprite,
   layout_background_sprite(texture_name);
 }
 
+inline std::string infinite_background_texture_for_round(int round_index) {
+  if (parsed_levels.empty()) return "";
+  const size_t index =
+      static_cast<size_t>(std::max(0, round_index)) % parsed_levels.size();
+  return parsed_levels[index].id;
+}
+
+// Background the level after the current one will show, if any.
+inline std::string next_background_texture() {
+  if (infinite_mode) return infinite_background_texture_for_round(infinite_round_index + 1);
+  if (tutorial_mode || current_level_index + 1 >= parsed_levels.size()) return "";
+  return parsed_levels[current_level_index + 1].id;
+}
+
 inline void set_background_texture(const std::string& texture_name) {
   if (!background_sprite) return;
   if (texture_name.empty()) return;
-  const engine::TextureId tex_id = engine::resources::register_texture(texture_name);
+  const engine::TextureId tex_id = shrooms::acquire_background(texture_name);
   if (tex_id != engine::kInvalidTextureId) {
     background_sprite->texture_id = tex_id;
     layout_background_sprite(texture_name);
   }
 }
 
-inline std::string infinite_background_texture_for_round(int round_index) {
-  if (parsed_levels.empty()) return "";
-  const size_t index =
-      static_cast<size_t>(std::max(0, round_index)) % parsed_levels.size();
-  return parsed_levels[index].id;
-}
-
 inline void apply_infinite_background_for_round(int round_index) {
   set_background_texture(infinite_background_texture_for_round(round_index));
 }
@@ -454,10 +492,10 @@ inline void unlock_next_level(size_t level_index) {
 }
 
 inline void reset_active_entities() {
-  for (auto& [type, entities] : active_entities) {
-    for (auto* entity : entities) {
-      if (entity) {
-        entity->mark_deleted();
+  for (auto& entities : active_entities.values) {
+    for (const auto& handle : entities) {
+      if (auto* entity = handle.get()) {
+        mushroom_pool::release(entity);
       }
     }
   }
@@ -483,7 +521,9 @@ inline std::string mode_seed_tag() {
 }
 
 inline void refresh_daily_seed_if_needed() {
-  const std::string today = daily_runtime::local_calendar_date().iso_yyyy_mm_dd();
+  const std::string today = !daily_date_override.empty()
+                                ? daily_date_override
+                                : daily_runtime::local_calendar_date().iso_yyyy_mm_dd();
   const std::string salt = std::string("shrooms_daily_infinite_v2_") + mode_seed_tag();
   const uint32_t seed = daily_runtime::day_hash(salt, today);
   if (today == current_daily_date && seed == current_daily_seed) {
@@ -493,6 +533,10 @@ inline void refresh_daily_seed_if_needed() {
   current_daily_seed = seed;
 }
 
+inline float scaled_spawn_period(float period) {
+  return spawn_rate_scale > 0.0f ? period / spawn_rate_scale : period;
+}
+
 inline uint32_t hash_daily_round(uint32_t stream, int round_index) {
   refresh_daily_seed_if_needed();
   uint32_t hash = current_daily_seed;
@@ -539,6 +583,7 @@ inline void seed_spawners_for_level(const LevelDefinition& level, size_t seed_in
 inline void build_infinite_spawner_cache() {
   base_spawner_plans.clear();
   infinite_types.clear();
+  base_plans_version += 1;
   for (const auto& level : parsed_levels) {
     for (const auto& plan : level.spawners) {
       if (base_spawner_plans.find(plan.type) != base_spawner_plans.end()) continue;
@@ -601,47 +646,229 @@ inline int infinite_target_for_round_type(int round_index, const std::string& ty
   return std::clamp(base + jitter, 1, 7);
 }
 
-inline void build_infinite_level(int round_index) {
+// The base plan an infinite round uses for `type`; periods and densities come from the first
+// level that spawns it.
+inline SpawnerPlan infinite_base_plan(const std::string& type) {
+  SpawnerPlan plan{};
+  plan.type = type;
+  auto base_it = base_spawner_plans.find(type);
+  if (base_it != base_spawner_plans.end()) {
+    plan.template_name = base_it->second.template_name;
+    plan.period = base_it->second.period;
+    plan.density = base_it->second.density;
+  } else {
+    plan.template_name = type + "_spawned";
+    plan.period = 2.0f;
+    plan.density = 0.7;
+  }
+  return plan;
+}
+
+// --- Daily schedule --------------------------------------------------------------------------
+// A whole daily infinite run precomputed into flat tables when the daily seed, game mode or base
+// plans change: every round's target and spawn plan per type, and the collector ticket queue with
+// each ticket's spawner seed. Round starts and ticket refills become lookups. Rounds and tickets
+// past the table are computed from the same hashes, so the table never changes a result. The
+// digest covers the whole table; compare it between native and web builds or export the table
+// with `shrooms_headless --schedule PATH` for balancing.
+
+inline constexpr bool kEnableScheduleLogging = false;
+inline constexpr int kScheduleRounds = 64;
+inline constexpr uint32_t kScheduleTickets = 2048;
+
+struct ScheduleEntry {
+  int32_t target = 0;
+  int32_t total_to_spawn = 0;
+  float period = 0.0f;
+  double density = 0.0;
+};
+
+struct ScheduleTicket {
+  uint32_t type_index = 0;
+  uint32_t seed = 0;
+};
+
+struct DailySchedule {
+  std::string date{};
+  uint32_t seed = 0;
+  GameMode mode = GameMode::Collector;
+  uint32_t plans_version = 0;
+  bool valid = false;
+  std::vector<std::string> types{};
+  std::vector<std::string> template_names{};
+  std::vector<ScheduleEntry> rounds{};  // kScheduleRounds rows of types.size() entries
+  std::vector<ScheduleTicket> tickets{};
+  uint32_t digest = 0;
+};
+
+inline DailySchedule daily_schedule{};
+
+inline ScheduleEntry compute_schedule_entry(int round_index, const std::string& type,
+                                            const SpawnerPlan& base) {
+  ScheduleEntry entry{};
+  entry.target = infinite_target_for_round_type(round_index, type);
+  entry.period = base.period;
+  entry.density = base.density;
+  if (current_game_mode == GameMode::Collector) {
+    entry.total_to_spawn = -1;
+  } else {
+    const int spare = std::max(2, entry.target / 2);
+    entry.total_to_spawn = std::max(1, entry.target + spare);
+  }
+  return entry;
+}
+
+inline uint32_t compute_ticket_type_index(uint32_t ticket_index, size_t type_count) {
+  const uint32_t hash = hash_daily_ticket(0x7235u, ticket_index);
+  return static_cast<uint32_t>(hash % type_count);
+}
+
+inline uint32_t compute_ticket_seed(uint32_t ticket_index, const std::string& type) {
+  uint32_t hash = hash_daily_ticket(0x9f41u, ticket_index);
+  hash = fnv1a_append(hash, type);
+  return hash;
+}
+
+template <typename T>
+inline uint32_t fnv1a_append_value(uint32_t hash, const T& value) {
+  unsigned char bytes[sizeof(T)];
+  std::memcpy(bytes, &value, sizeof(T));
+  for (unsigned char c : bytes) {
+    hash ^= static_cast<uint32_t>(c);
+    hash *= 16777619u;
+  }
+  return hash;
+}
+
+inline uint32_t schedule_digest(const DailySchedule& schedule) {
+  uint32_t hash = fnv1a_append(2166136261u, schedule.date);
+  hash = fnv1a_append_value(hash, schedule.seed);
+  hash = fnv1a_append_value(hash, static_cast<int32_t>(schedule.mode));
+  for (size_t i = 0; i < schedule.types.size(); ++i) {
+    hash = fnv1a_append(hash, schedule.types[i]);
+    hash = fnv1a_append(hash, schedule.template_names[i]);
+  }
+  for (const auto& entry : schedule.rounds) {
+    hash = fnv1a_append_value(hash, entry.target);
+    hash = fnv1a_append_value(hash, entry.total_to_spawn);
+    hash = fnv1a_append_value(hash, entry.period);
+    hash = fnv1a_append_value(hash, entry.density);
+  }
+  for (const auto& ticket : schedule.tickets) {
+    hash = fnv1a_append_value(hash, ticket.type_index);
+    hash = fnv1a_append_value(hash, ticket.seed);
+  }
+  return hash;
+}
+
+inline void build_daily_schedule() {
+  DailySchedule schedule{};
+  schedule.date = current_daily_date;
+  schedule.seed = current_daily_seed;
+  schedule.mode = current_game_mode;
+  schedule.plans_version = base_plans_version;
+  schedule.types = infinite_types;
+
+  std::vector<SpawnerPlan> base_plans;
+  base_plans.reserve(schedule.types.size());
+  for (const auto& type : schedule.types) {
+    base_plans.push_back(infinite_base_plan(type));
+    schedule.template_names.push_back(base_plans.back().template_name);
+  }
+  schedule.rounds.reserve(static_cast<size_t>(kScheduleRounds) * schedule.types.size());
+  for (int round = 0; round < kScheduleRounds; ++round) {
+    for (size_t i = 0; i < schedule.types.size(); ++i) {
+      schedule.rounds.push_back(compute_schedule_entry(round, schedule.types[i], base_plans[i]));
+    }
+  }
+  if (!schedule.types.empty()) {
+    schedule.tickets.reserve(kScheduleTickets);
+    for (uint32_t ticket = 0; ticket < kScheduleTickets; ++ticket) {
+      const uint32_t type_index = compute_ticket_type_index(ticket, schedule.types.size());
+      schedule.tickets.push_back(
+          ScheduleTicket{type_index, compute_ticket_seed(ticket, schedule.types[type_index])});
+    }
+  }
+  schedule.digest = schedule_digest(schedule);
+  schedule.valid = true;
+  daily_schedule = std::move(schedule);
+
+  if constexpr (kEnableScheduleLogging) {
+    std::cerr << "[schedule] " << daily_schedule.date << " " << mode_seed_tag()
+              << " types=" << daily_schedule.types.size() << " digest=" << std::hex
+              << daily_schedule.digest << std::dec << "\n";
+  }
+}
+
+inline const DailySchedule& current_daily_schedule() {
   refresh_daily_seed_if_needed();
+  if (infinite_types.empty()) {
+    build_infinite_spawner_cache();
+  }
+  const bool current = daily_schedule.valid && daily_schedule.date == current_daily_date &&
+                       daily_schedule.seed == current_daily_seed &&
+                       daily_schedule.mode == current_game_mode &&
+                       daily_schedule.plans_version == base_plans_version;
+  if (!current) {
+    build_daily_schedule();
+  }
+  return daily_schedule;
+}
+
+inline ScheduleEntry schedule_entry(const DailySchedule& schedule, int round_index,
+                                    size_t type_index) {
+  if (round_index >= 0 && round_index < kScheduleRounds) {
+    return schedule.rounds[static_cast<size_t>(round_index) * schedule.types.size() +
+                           type_index];
+  }
+  const std::string& type = schedule.types[type_index];
+  return compute_schedule_entry(round_index, type, infinite_base_plan(type));
+}
+
+// One line per round and type, then one per collector ticket.
+inline std::string daily_schedule_csv() {
+  const DailySchedule& schedule = current_daily_schedule();
+  std::ostringstream out;
+  out << "# date=" << schedule.date << " mode=" << mode_seed_tag() << " seed=" << schedule.seed
+      << " digest=" << schedule.digest << "\n";
+  out << "kind,index,type,target,period,density,total_to_spawn,seed\n";
+  out.precision(9);
+  for (int round = 0; round < kScheduleRounds; ++round) {
+    for (size_t i = 0; i < schedule.types.size(); ++i) {
+      const ScheduleEntry entry = schedule_entry(schedule, round, i);
+      out << "round," << round << ',' << schedule.types[i] << ',' << entry.target << ','
+          << entry.period << ',' << entry.density << ',' << entry.total_to_spawn << ",\n";
+    }
+  }
+  for (size_t ticket = 0; ticket < schedule.tickets.size(); ++ticket) {
+    const auto& entry = schedule.tickets[ticket];
+    out << "ticket," << ticket << ',' << schedule.types[entry.type_index] << ",,,,,"
+        << entry.seed << "\n";
+  }
+  return out.str();
+}
+
+inline void build_infinite_level(int round_index) {
+  const DailySchedule& schedule = current_daily_schedule();
   infinite_level = LevelDefinition{};
   infinite_level.id = "Infinite";
   infinite_level.recipe.clear();
   infinite_level.recipe_order.clear();
   infinite_level.spawners.clear();
 
-  if (infinite_types.empty()) {
-    build_infinite_spawner_cache();
-  }
-  if (infinite_types.empty()) {
+  if (schedule.types.empty()) {
     return;
   }
 
-  for (const auto& type : infinite_types) {
-    const int target = infinite_target_for_round_type(round_index, type);
+  for (size_t i = 0; i < schedule.types.size(); ++i) {
+    const std::string& type = schedule.types[i];
+    const ScheduleEntry entry = schedule_entry(schedule, round_index, i);
     if (current_game_mode == GameMode::Recipe) {
-      infinite_level.recipe[type] = target;
-      infinite_level.recipe_order.emplace_back(type, target);
+      infinite_level.recipe[mushroom_types::intern(type)] = entry.target;
+      infinite_level.recipe_order.emplace_back(type, entry.target);
     }
-
-    SpawnerPlan plan{};
-    plan.type = type;
-    auto base_it = base_spawner_plans.find(type);
-    if (base_it != base_spawner_plans.end()) {
-      plan.template_name = base_it->second.template_name;
-      plan.period = base_it->second.period;
-      plan.density = base_it->second.density;
-    } else {
-      plan.template_name = type + "_spawned";
-      plan.period = 2.0f;
-      plan.density = 0.7;
-    }
-    if (current_game_mode == GameMode::Collector) {
-      plan.total_to_spawn = -1;
-    } else {
-      const int spare = std::max(2, target / 2);
-      plan.total_to_spawn = std::max(1, target + spare);
-    }
-    infinite_level.spawners.push_back(plan);
+    infinite_level.spawners.push_back(SpawnerPlan{type, schedule.template_names[i], entry.period,
+                                                  entry.density, entry.total_to_spawn});
   }
   infinite_level.objective_rule = ObjectiveRule::CollectOnly;
   infinite_level.objective_hint =
@@ -649,20 +876,23 @@ inline void build_infinite_level(int round_index) {
 }
 
 inline std::string infinite_collector_type_for_ticket(uint32_t ticket_index) {
-  if (infinite_types.empty()) {
-    build_infinite_spawner_cache();
-  }
-  if (infinite_types.empty()) {
+  const DailySchedule& schedule = current_daily_schedule();
+  if (schedule.types.empty()) {
     return "";
   }
-  const uint32_t hash = hash_daily_ticket(0x7235u, ticket_index);
-  return infinite_types[static_cast<size_t>(hash % infinite_types.size())];
+  if (ticket_index < schedule.tickets.size()) {
+    return schedule.types[schedule.tickets[ticket_index].type_index];
+  }
+  return schedule.types[compute_ticket_type_index(ticket_index, schedule.types.size())];
 }
 
 inline uint32_t infinite_collector_seed_for_ticket(const InfiniteCollectorTicket& ticket) {
-  uint32_t hash = hash_daily_ticket(0x9f41u, ticket.index);
-  hash = fnv1a_append(hash, ticket.type);
-  return hash;
+  const DailySchedule& schedule = current_daily_schedule();
+  if (ticket.index < schedule.tickets.size()) {
+    const ScheduleTicket& entry = schedule.tickets[ticket.index];
+    if (schedule.types[entry.type_index] == ticket.type) return entry.seed;
+  }
+  return compute_ticket_seed(ticket.index, ticket.type);
 }
 
 inline void refill_infinite_collector_queue() {
@@ -704,6 +934,45 @@ inline void disable_all_spawners() {
       spawner->enabled = false;
     }
   }
+  spawn_governor::forget();
+}
+
+// Mushrooms deleted outside the catch, miss and sort paths (tutorial stage clears, a familiar
+// dropping its load) leave stale handles behind until the next level start.
+inline size_t live_active_entities(mushroom_types::MushroomTypeId type) {
+  if (type >= active_entities.values.size()) return 0;
+  size_t live = 0;
+  for (const auto& handle : active_entities.values[type]) {
+    if (handle.get()) ++live;
+  }
+  return live;
+}
+
+// Holds enabled spawners whose type or the whole field is at its live cap and resumes held
+// ones once a slot frees up (see spawn_governor).
+inline void govern_spawners() {
+  if (!spawn_governor::caps_enabled() && spawn_governor::held.empty()) return;
+  size_t live_total = 0;
+  for (size_t type = 0; type < active_entities.values.size(); ++type) {
+    live_total += live_active_entities(static_cast<mushroom_types::MushroomTypeId>(type));
+  }
+  for (const auto& [spawner, type] : typed_spawners) {
+    if (!spawner) continue;
+    bool held = spawn_governor::is_held(spawner);
+    // Something re-enabled a held spawner (level setup, reload); judge it afresh.
+    if (held && spawner->enabled) {
+      spawn_governor::forget(spawner);
+      held = false;
+    }
+    if (!held && !spawner->enabled) continue;
+    const size_t live = live_active_entities(type);
+    const bool admits = spawn_governor::admits(live, live_total);
+    if (held && admits) {
+      spawn_governor::release(spawner);
+    } else if (!held && !admits) {
+      spawn_governor::hold(spawner);
+    }
+  }
 }
 
 inline void activate_infinite_collector_front_spawner() {
@@ -721,9 +990,10 @@ inline void activate_infinite_collector_front_spawner() {
 
     const SpawnerPlan plan = infinite_collector_plan_for_type(ticket.type);
     auto* spawner = spawner_it->second;
-    spawner->configure(plan.period, plan.density, 1);
+    spawner->configure(scaled_spawn_period(plan.period), plan.density, 1);
     spawner->reseed(infinite_collector_seed_for_ticket(ticket));
     spawner->enabled = true;
+    govern_spawners();
     return;
   }
 }
@@ -758,13 +1028,13 @@ inline void prepare_infinite_preview() {
 }
 
 inline void parse_levels(const std::string& filename) {
-  parsed_levels.clear();
-  base_levels.clear();
   std::ifstream in(filename);
   if (!in.is_open()) {
     std::cerr << "Failed to open level config: " << filename << std::endl;
     return;
   }
+  parsed_levels.clear();
+  base_levels.clear();
 
   LevelDefinition current{};
   std::string token;
@@ -779,7 +1049,7 @@ inline void parse_levels(const std::string& filename) {
       std::string type;
       int count = 0;
       in >> type >> count;
-      current.recipe[type] = count;
+      current.recipe[mushroom_types::intern(type)] = count;
       current.recipe_order.emplace_back(type, count);
     } else if (token == "spawn") {
       SpawnerPlan plan{};
@@ -799,6 +1069,29 @@ inline void parse_levels(const std::string& filename) {
   apply_mode_to_levels();
 }
 
+inline void load_levels_from_pack(const level_pack::Pack& pack) {
+  parsed_levels.clear();
+  base_levels.clear();
+  parsed_levels.reserve(pack.levels.size());
+  for (const auto& source : pack.levels) {
+    LevelDefinition level{};
+    level.id = pack.str(source.id);
+    for (const auto& entry : source.recipe) {
+      const std::string& type = pack.str(entry.type);
+      level.recipe[mushroom_types::intern(type)] = entry.count;
+      level.recipe_order.emplace_back(type, entry.count);
+    }
+    level.spawners.reserve(source.spawns.size());
+    for (const auto& spawn : source.spawns) {
+      level.spawners.push_back(SpawnerPlan{pack.str(spawn.type), pack.str(spawn.template_name),
+                                           spawn.period, spawn.density, spawn.total_to_spawn});
+    }
+    parsed_levels.push_back(std::move(level));
+  }
+  base_levels = parsed_levels;
+  apply_mode_to_levels();
+}
+
 inline void register_spawner(periodic_spawn::PeriodicSpawnerObject* spawner) {
   if (!spawner) return;
   if (spawner->spawn_type.empty()) {
@@ -806,14 +1099,46 @@ inline void register_spawner(periodic_spawn::PeriodicSpawnerObject* spawner) {
     return;
   }
   spawners_by_type[spawner->spawn_type] = spawner;
+  const auto type = mushroom_types::intern(spawner->spawn_type);
+  for (auto& typed : typed_spawners) {
+    if (typed.type != type) continue;
+    spawn_governor::forget(typed.spawner);
+    typed.spawner = spawner;
+    return;
+  }
+  typed_spawners.push_back(TypedSpawner{spawner, type});
 }
 
-inline void update_scoreboard_for(const std::string& type) {
+inline periodic_spawn::PeriodicSpawnerObject* find_spawner(const std::string& type) {
+  const auto it = spawners_by_type.find(type);
+  return it == spawners_by_type.end() ? nullptr : it->second;
+}
+
+// mushrooms.data changed the period a spawner was built with. The running level's plan for the
+// type, when it has one, sets the period itself and wins; otherwise the spawner takes the new
+// period, keeping its progress and enabled state.
+inline void apply_source_spawn_period(const std::string& type, float period, double density) {
+  auto* spawner = find_spawner(type);
+  if (!spawner) return;
+  if (const auto* level = current_level(); level && !level_finished) {
+    for (const auto& plan : level->spawners) {
+      if (plan.type == type) return;
+    }
+  }
+  const auto spawned = spawner->spawned_count;
+  const auto max_spawns = spawner->max_spawn_count;
+  const bool enabled = spawner->enabled;
+  spawner->configure(scaled_spawn_period(period), density, max_spawns);
+  spawner->spawned_count = spawned;
+  spawner->enabled = enabled;
+}
+
+inline void update_scoreboard_for(mushroom_types::MushroomTypeId type) {
   auto* level = current_level();
   if (!level) return;
-  auto target_it = level->recipe.find(type);
-  if (target_it == level->recipe.end()) return;
-  scoreboard::update_score(type, progress_for_type(*level, type), target_it->second);
+  const int target = level->recipe.get(type);
+  if (target == kNotInRecipe) return;
+  scoreboard::update_score(type, progress_for_type(*level, type), target);
 }
 
 inline constexpr int kScoreCatch = 10;
@@ -843,11 +1168,12 @@ inline int apply_score_delta(int delta, const glm::vec2& anchor, bool show_popup
   return applied;
 }
 
-inline void maybe_award_recipe_milestone(const std::string& type, int progress, int target,
-                                         const glm::vec2& anchor, bool allow_score_effects) {
+inline void maybe_award_recipe_milestone(mushroom_types::MushroomTypeId type, int progress,
+                                         int target, const glm::vec2& anchor,
+                                         bool allow_score_effects) {
   if (!allow_score_effects) return;
   if (progress != target) return;
-  if (!milestone_bonus_awarded.insert(type).second) return;
+  if (!milestone_bonus_awarded.insert(mushroom_types::name(type)).second) return;
   apply_score_delta(kScoreMilestone, anchor, true);
 }
 
@@ -887,7 +1213,11 @@ inline void finalize_success_after_transition() {
 inline void start_level_completed_transition() {
   if (level_finished || game_over_pending) return;
   if (round_transition::is_active()) return;
-  round_transition::start_level_completed([]() { finalize_success_after_transition(); });
+  // Rasterize once the overlay covers the paused field, not on the frame of the final catch
+  // with its burst and score popups, and not when the next level starts.
+  round_transition::start_level_completed(
+      []() { finalize_success_after_transition(); },
+      []() { shrooms::prefetch_background(next_background_texture()); });
 }
 
 inline ecs::Entity* spawn_mushroom_now(const std::string& type, const glm::vec2& center_px) {
@@ -909,24 +1239,30 @@ inline std::string default_spawn_type() {
   return "mukhomor";
 }
 
-inline void on_mushroom_spawned(const std::string& type, ecs::Entity* entity) {
+inline void on_mushroom_spawned(mushroom_types::MushroomTypeId type, ecs::Entity* entity) {
+  const std::string& type_name = mushroom_types::name(type);
   if (tutorial_spawn_hook) {
-    tutorial_spawn_hook(type, entity);
+    tutorial_spawn_hook(type_name, entity);
   }
-  if (!current_level()) return;
-  active_entities[type].insert(entity);
-  on_infinite_collector_ticket_spawned(type);
+  if (!current_level() || type == mushroom_types::kNoType) return;
+  active_entities[type].insert(entity_handles::Handle(entity));
+  on_infinite_collector_ticket_spawned(type_name);
+}
+
+inline void forget_active_entity(mushroom_types::MushroomTypeId type, ecs::Entity* entity) {
+  if (type >= active_entities.values.size()) return;
+  active_entities.values[type].erase(entity_handles::Handle::lookup(entity));
 }
 
 inline void on_mushroom_caught(
-    const std::string& type, ecs::Entity* entity,
+    mushroom_types::MushroomTypeId type, ecs::Entity* entity,
     glm::vec2 player_center = glm::vec2{std::numeric_limits<float>::quiet_NaN(),
                                         std::numeric_limits<float>::quiet_NaN()},
     bool from_familiar = false) {
   if (!entity || entity->is_pending_deletion()) return;
   if (vfx::is_mushroom_vfx_locked(entity)) return;
   if (tutorial_catch_hook) {
-    tutorial_catch_hook(type, entity, from_familiar);
+    tutorial_catch_hook(mushroom_types::name(type), entity, from_familiar);
   }
   shrooms::audio::play_mushroom_catch();
   auto* level = current_level();
@@ -935,15 +1271,13 @@ inline void on_mushroom_caught(
   const glm::vec2 score_anchor = score_anchor_for_entity(entity);
   const bool score_enabled = !tutorial_mode;
 
-  auto active_it = active_entities.find(type);
-  if (active_it != active_entities.end()) {
-    active_it->second.erase(entity);
-  }
+  forget_active_entity(type, entity);
   camera_shake::add_trauma(0.12f);
 
-  auto recipe_it = level->recipe.find(type);
-  if (recipe_it == level->recipe.end()) {
-    if (current_game_mode == GameMode::Collector && !tutorial_mode) {
+  const int target = level->recipe.get(type);
+  if (target == kNotInRecipe) {
+    if (current_game_mode == GameMode::Collector && !tutorial_mode &&
+        type != mushroom_types::kNoType) {
       if (score_enabled) {
         apply_score_delta(kScoreCatch, score_anchor, true);
       }
@@ -957,26 +1291,23 @@ inline void on_mushroom_caught(
   }
   collected_counts[type] += 1;
   update_scoreboard_for(type);
-  maybe_award_recipe_milestone(type, progress_for_type(*level, type), recipe_it->second, score_anchor,
+  maybe_award_recipe_milestone(type, progress_for_type(*level, type), target, score_anchor,
                                score_enabled);
-  if (progress_for_type(*level, type) > recipe_it->second) {
-    trigger_failure(LossReason::TooMany, type);
+  if (progress_for_type(*level, type) > target) {
+    trigger_failure(LossReason::TooMany, mushroom_types::name(type));
     return;
   }
   check_completion();
 }
 
-inline void on_mushroom_missed(const std::string& type, ecs::Entity* entity) {
+inline void on_mushroom_missed(mushroom_types::MushroomTypeId type, ecs::Entity* entity) {
   if (!entity || entity->is_pending_deletion()) return;
   if (vfx::is_mushroom_vfx_locked(entity)) return;
   if (tutorial_miss_hook) {
-    tutorial_miss_hook(type, entity);
+    tutorial_miss_hook(mushroom_types::name(type), entity);
   }
   if (!current_level()) return;
-  auto active_it = active_entities.find(type);
-  if (active_it != active_entities.end()) {
-    active_it->second.erase(entity);
-  }
+  forget_active_entity(type, entity);
   if (!tutorial_mode) {
     apply_score_delta(kScoreMiss, score_anchor_for_entity(entity), true);
   }
@@ -986,7 +1317,7 @@ inline void on_mushroom_missed(const std::string& type, ecs::Entity* entity) {
     if (current_game_mode == GameMode::Collector) {
       decrement_collector_life();
       if (collector_lives_remaining <= 0) {
-        trigger_failure(LossReason::Dropped, type);
+        trigger_failure(LossReason::Dropped, mushroom_types::name(type));
         return;
       }
     }
@@ -999,37 +1330,35 @@ inline void on_mushroom_sorted(ecs::Entity* entity) {
   if (vfx::is_mushroom_vfx_locked(entity)) return;
   auto* level = current_level();
   if (!level) {
-    entity->mark_deleted();
+    mushroom_pool::release(entity);
     return;
   }
-  auto* sprite = entity->get<render_system::SpriteRenderable>();
-  std::string type = sprite ? engine::resources::texture_name(sprite->texture_id) : "";
+  const mushroom_types::MushroomTypeId type = mushroom_types::of(entity);
   if (tutorial_sort_hook) {
-    tutorial_sort_hook(type, entity);
+    tutorial_sort_hook(mushroom_types::name(type), entity);
   }
   shrooms::audio::play_mushroom_shot();
-  auto active_it = active_entities.find(type);
-  if (active_it != active_entities.end()) {
-    active_it->second.erase(entity);
-  }
+  forget_active_entity(type, entity);
   const glm::vec2 score_anchor = score_anchor_for_entity(entity);
   const bool score_enabled = !tutorial_mode;
-  auto recipe_it = level->recipe.find(type);
+  const int target = level->recipe.get(type);
   if (score_enabled) {
     apply_score_delta(kScoreSort, score_anchor, true);
   }
-  sorted_counts[type] += 1;
+  if (type != mushroom_types::kNoType) {
+    sorted_counts[type] += 1;
+  }
   update_scoreboard_for(type);
-  if (recipe_it != level->recipe.end()) {
-    maybe_award_recipe_milestone(type, progress_for_type(*level, type), recipe_it->second,
-                                 score_anchor, score_enabled);
+  if (target != kNotInRecipe) {
+    maybe_award_recipe_milestone(type, progress_for_type(*level, type), target, score_anchor,
+                                 score_enabled);
   }
-  if (recipe_it != level->recipe.end() && progress_for_type(*level, type) > recipe_it->second) {
-    trigger_failure(LossReason::TooMany, type);
+  if (target != kNotInRecipe && progress_for_type(*level, type) > target) {
+    trigger_failure(LossReason::TooMany, mushroom_types::name(type));
   }
   vfx::spawn_destroy_effect(entity);
   camera_shake::add_trauma(0.1f);
-  entity->mark_deleted();
+  mushroom_pool::release(entity);
   check_completion();
 }
 
@@ -1047,9 +1376,59 @@ inline void configure_spawners_for_level(const LevelDefinition& level) {
       continue;
     }
     auto* spawner = it->second;
-    spawner->configure(plan.period, plan.density, plan.total_to_spawn);
+    spawner->configure(scaled_spawn_period(plan.period), plan.density, plan.total_to_spawn);
     spawner->enabled = true;
   }
+  // Apply the caps before the spawners' next tick rather than after it.
+  govern_spawners();
+}
+
+inline bool same_plan(const SpawnerPlan& a, const SpawnerPlan& b) {
+  return a.template_name == b.template_name && a.period == b.period && a.density == b.density &&
+         a.total_to_spawn == b.total_to_spawn;
+}
+
+// Hot reload of levels.data: rebuilds parsed_levels, base_levels and base_spawner_plans in
+// place. Spawners of the running level whose plan changed are reconfigured, keeping their
+// spawned count; mushrooms already on screen are left alone. The rebuilt definition may carry a
+// new recipe, so the scoreboard is rebuilt from it with the counts so far. Returns the
+// reconfigured types.
+inline std::vector<std::string> reload_levels(const std::string& filename) {
+  std::unordered_map<std::string, SpawnerPlan> running_plans;
+  const bool running = !level_finished && !game_over_pending && current_level() != nullptr;
+  if (running) {
+    for (const auto& plan : current_level()->spawners) running_plans[plan.type] = plan;
+  }
+
+  parse_levels(filename);
+  if (!running || tutorial_mode) return {};
+  if (infinite_mode) {
+    build_infinite_level(infinite_round_index);
+    // Collector runs pick up base_spawner_plans with their next ticket.
+    if (is_infinite_collector_run()) return {};
+  }
+  const LevelDefinition* level = current_level();
+  if (!level) return {};
+
+  scoreboard::init_with_targets(level->recipe_order, "");
+  for (const auto& [type, target] : level->recipe_order) {
+    update_scoreboard_for(mushroom_types::intern(type));
+  }
+
+  std::vector<std::string> changed;
+  for (const auto& plan : level->spawners) {
+    const auto old = running_plans.find(plan.type);
+    if (old == running_plans.end() || same_plan(old->second, plan)) continue;
+    auto* spawner = find_spawner(plan.type);
+    if (!spawner) continue;
+    const auto spawned = spawner->spawned_count;
+    const bool enabled = spawner->enabled;
+    spawner->configure(scaled_spawn_period(plan.period), plan.density, plan.total_to_spawn);
+    spawner->spawned_count = spawned;
+    spawner->enabled = enabled;
+    changed.push_back(plan.type);
+  }
+  return changed;
 }
 
 inline void start_level_with_definition(const LevelDefinition& level, size_t display_index,
@@ -1060,6 +1439,7 @@ inline void start_level_with_definition(const LevelDefinition& level, size_t dis
   game_over_pending = false;
   pending_loss = LossInfo{};
   reset_active_entities();
+  memory_stats::on_round_start();
 
   last_played_level_index = display_index;
   last_game_status = status_label;
@@ -1074,21 +1454,14 @@ inline void start_level_with_definition(const LevelDefinition& level, size_t dis
   }
   collected_counts.clear();
   sorted_counts.clear();
-  for (const auto& [type, target] : level.recipe_order) {
-    collected_counts[type] = 0;
-    sorted_counts[type] = 0;
-  }
-  for (const auto& plan : level.spawners) {
-    collected_counts.try_emplace(plan.type, 0);
-    sorted_counts.try_emplace(plan.type, 0);
-  }
   const std::string score_task = "";
   scoreboard::init_with_targets(level.recipe_order, score_task);
   reset_collector_lives_if_needed();
   configure_spawners_for_level(level);
   seed_spawners_for_level(level, seed_index);
+  rng_streams::seed_for_level(seed_for_level(level, seed_index, "rng_streams"));
   for (const auto& [type, target] : level.recipe_order) {
-    update_scoreboard_for(type);
+    update_scoreboard_for(mushroom_types::intern(type));
   }
   apply_level_background(level);
 
@@ -1119,6 +1492,9 @@ inline void start_infinite_mode() {
                 " (score " + std::to_string(current_run_score) + ")";
   start_level_with_definition(infinite_level, infinite_menu_index(),
                               static_cast<size_t>(infinite_round_index), status);
+  if (infinite_run_started_hook) {
+    infinite_run_started_hook();
+  }
 }
 
 inline void advance_infinite_round() {
@@ -1223,7 +1599,7 @@ inline bool all_spawns_exhausted() {
     if (!spawner->is_depleted()) {
       return false;
     }
-    if (!active_entities[plan.type].empty()) {
+    if (!active_entities.get(mushroom_types::intern(plan.type)).empty()) {
       return false;
     }
   }
@@ -1254,11 +1630,8 @@ inline LossInfo evaluate_loss_info() {
       info.type = type;
       return info;
     }
-    int active_count = 0;
-    auto active_it = active_entities.find(type);
-    if (active_it != active_entities.end()) {
-      active_count = static_cast<int>(active_it->second.size());
-    }
+    const int active_count =
+        static_cast<int>(active_entities.get(mushroom_types::intern(type)).size());
     const int remaining = remaining_spawns_for(type);
     if (remaining < 0) {
       continue;
@@ -1279,11 +1652,7 @@ inline void trigger_failure(LossReason reason, const std::string& type) {
   game_over_pending = true;
   pending_loss.reason = reason;
   pending_loss.type = type;
-  for (auto& [_, spawner] : spawners_by_type) {
-    if (spawner) {
-      spawner->enabled = false;
-    }
-  }
+  disable_all_spawners();
 }
 
 inline void finalize_level(bool success) {
@@ -1291,12 +1660,12 @@ inline void finalize_level(bool success) {
   if (!level) return;
 
   int total_sorted = 0;
-  for (const auto& [type, sorted] : sorted_counts) {
+  for (const int sorted : sorted_counts.values) {
     total_sorted += sorted;
   }
 
   int total_collected = 0;
-  for (const auto& [type, collected] : collected_counts) {
+  for (const int collected : collected_counts.values) {
     total_collected += collected;
   }
 
@@ -1342,11 +1711,7 @@ inline void finalize_level(bool success) {
     last_game_success = false;
   }
 
-  for (auto& [type, spawner] : spawners_by_type) {
-    if (spawner) {
-      spawner->enabled = false;
-    }
-  }
+  disable_all_spawners();
   reset_active_entities();
   if (infinite_mode) {
     infinite_mode = false;
@@ -1418,7 +1783,13 @@ inline void check_completion() {
 
 inline void initialize() {
   current_game_mode = load_selected_mode();
-  parse_levels(shrooms::asset_path("levels.data"));
+  if (const auto* pack = level_pack::load_cached(shrooms::asset_path("levels.pack"),
+                                                 shrooms::asset_path("levels.data"),
+                                                 shrooms::asset_path("mushrooms.data"))) {
+    load_levels_from_pack(*pack);
+  } else {
+    parse_levels(shrooms::asset_path("levels.data"));
+  }
   build_infinite_spawner_cache();
   leaderboard::set_profile(leaderboard_profile_for_mode(current_game_mode));
   leaderboard::load_or_default();
@@ -0,0 +1,421 @@
+#pragma once
+
+#include <array>
+#include <bit>
+#include <cstdint>
+#include <cstring>
+#include <fstream>
+#include <iostream>
+#include <iterator>
+#include <string>
+#include <vector>
+
+// Compiled form of assets/levels.data and assets/mushrooms.data, produced by the
+// shrooms_level_pack host tool (src/tools/level_pack.cpp) and written to levels.pack.
+// Every string (ids, texture and handler names) lives once in a string table and is referenced
+// by index; entities are stored flat, with spawners pointing at the entity they spawn. Values
+// stay in the units of the text files because pixel conversion depends on the view size, so
+// decoding is a bounds-checked walk over the bytes with no tokenizer. Kept free of engine
+// headers so the host tool can include it.
+//
+// The header records an FNV-1a hash of the two text files it was compiled from; a pack whose
+// sources have since changed is ignored and the text files are parsed instead.
+//
+// Layout (little endian): magic, version, source hash, payload size, payload FNV-1a hash, then
+// the payload:
+//   strings: count, { length, bytes }
+//   entities: count, { name, texture, root, components: count, { component } }
+//   levels: count, { id, recipe: count, { type, count }, spawns: count, { spawn } }
+namespace level_pack {
+
+static_assert(std::endian::native == std::endian::little,
+              "level packs are read by copying little-endian fields directly");
+
+inline constexpr uint32_t kMagic = 0x504c4853u;  // "SHLP"
+inline constexpr uint32_t kFormatVersion = 2;
+inline constexpr uint32_t kNone = 0xffffffffu;
+
+// Same order as level_loader::ComponentKind.
+enum class ComponentKind : uint8_t {
+  Geometry,
+  Color,
+  Layer,
+  Moving,
+  Rotating,
+  Collider,
+  Trigger,
+  PeriodicSpawner,
+};
+
+enum class GeometryType : uint8_t {
+  Quad,
+  Polygon,
+};
+
+struct Component {
+  ComponentKind kind = ComponentKind::Geometry;
+  GeometryType geometry_type = GeometryType::Quad;
+  std::vector<float> points{};  // normalized x, y pairs
+  std::array<uint8_t, 4> color{255, 255, 255, 255};
+  int32_t layer = 0;
+  float move_x = 0.0f;
+  float move_y = 0.0f;
+  uint8_t angle_random = 0;
+  float angle_value = 0.0f;
+  float angle_min = 0.0f;
+  float angle_max = 0.0f;
+  uint32_t handler = kNone;
+  float spawner_period = 0.0f;
+  double spawner_density = 0.0;
+  uint32_t spawner_entity = kNone;
+};
+
+struct Entity {
+  uint32_t name = kNone;
+  uint32_t texture = kNone;
+  uint8_t root = 0;  // top-level entity in mushrooms.data rather than a spawner's template
+  std::vector<Component> components{};
+};
+
+struct RecipeEntry {
+  uint32_t type = kNone;
+  int32_t count = 0;
+};
+
+struct Spawn {
+  uint32_t type = kNone;
+  uint32_t template_name = kNone;
+  float period = 0.0f;
+  double density = 0.0;
+  int32_t total_to_spawn = 0;
+};
+
+struct Level {
+  uint32_t id = kNone;
+  std::vector<RecipeEntry> recipe{};
+  std::vector<Spawn> spawns{};
+};
+
+struct Pack {
+  uint32_t source_hash = 0;
+  std::vector<std::string> strings{};
+  std::vector<Entity> entities{};
+  std::vector<Level> levels{};
+
+  const std::string& str(uint32_t index) const {
+    static const std::string empty{};
+    return index < strings.size() ? strings[index] : empty;
+  }
+};
+
+inline constexpr uint32_t kHashSeed = 2166136261u;
+
+inline uint32_t payload_hash(const uint8_t* data, size_t size, uint32_t hash = kHashSeed) {
+  for (size_t i = 0; i < size; ++i) {
+    hash ^= data[i];
+    hash *= 16777619u;
+  }
+  return hash;
+}
+
+// Hash of levels.data followed by mushrooms.data; false when either cannot be read.
+inline bool hash_sources(const std::string& levels_path, const std::string& mushrooms_path,
+                         uint32_t& hash) {
+  hash = kHashSeed;
+  for (const std::string* path : {&levels_path, &mushrooms_path}) {
+    std::ifstream in(*path, std::ios::binary);
+    if (!in.is_open()) return false;
+    const std::vector<uint8_t> bytes((std::istreambuf_iterator<char>(in)),
+                                     std::istreambuf_iterator<char>());
+    hash = payload_hash(bytes.data(), bytes.size(), hash);
+  }
+  return true;
+}
+
+// --- Encoding --------------------------------------------------------------------------------
+
+struct Writer {
+  std::vector<uint8_t> bytes{};
+
+  template <typename T>
+  void put(T value) {
+    const size_t at = bytes.size();
+    bytes.resize(at + sizeof(T));
+    std::memcpy(bytes.data() + at, &value, sizeof(T));
+  }
+
+  void put_string(const std::string& value) {
+    put(static_cast<uint32_t>(value.size()));
+    bytes.insert(bytes.end(), value.begin(), value.end());
+  }
+};
+
+inline void write_component(Writer& out, const Component& c) {
+  out.put(static_cast<uint8_t>(c.kind));
+  switch (c.kind) {
+    case ComponentKind::Geometry:
+      out.put(static_cast<uint8_t>(c.geometry_type));
+      out.put(static_cast<uint32_t>(c.points.size() / 2));
+      for (float value : c.points) out.put(value);
+      break;
+    case ComponentKind::Color:
+      for (uint8_t channel : c.color) out.put(channel);
+      break;
+    case ComponentKind::Layer:
+      out.put(c.layer);
+      break;
+    case ComponentKind::Moving:
+      out.put(c.move_x);
+      out.put(c.move_y);
+      break;
+    case ComponentKind::Rotating:
+      out.put(c.angle_random);
+      out.put(c.angle_value);
+      out.put(c.angle_min);
+      out.put(c.angle_max);
+      break;
+    case ComponentKind::Collider:
+    case ComponentKind::Trigger:
+      out.put(c.handler);
+      break;
+    case ComponentKind::PeriodicSpawner:
+      out.put(c.spawner_period);
+      out.put(c.spawner_density);
+      out.put(c.spawner_entity);
+      break;
+  }
+}
+
+inline std::vector<uint8_t> encode(const Pack& pack) {
+  Writer payload{};
+  payload.put(static_cast<uint32_t>(pack.strings.size()));
+  for (const auto& value : pack.strings) payload.put_string(value);
+
+  payload.put(static_cast<uint32_t>(pack.entities.size()));
+  for (const auto& entity : pack.entities) {
+    payload.put(entity.name);
+    payload.put(entity.texture);
+    payload.put(entity.root);
+    payload.put(static_cast<uint32_t>(entity.components.size()));
+    for (const auto& component : entity.components) write_component(payload, component);
+  }
+
+  payload.put(static_cast<uint32_t>(pack.levels.size()));
+  for (const auto& level : pack.levels) {
+    payload.put(level.id);
+    payload.put(static_cast<uint32_t>(level.recipe.size()));
+    for (const auto& entry : level.recipe) {
+      payload.put(entry.type);
+      payload.put(entry.count);
+    }
+    payload.put(static_cast<uint32_t>(level.spawns.size()));
+    for (const auto& spawn : level.spawns) {
+      payload.put(spawn.type);
+      payload.put(spawn.template_name);
+      payload.put(spawn.period);
+      payload.put(spawn.density);
+      payload.put(spawn.total_to_spawn);
+    }
+  }
+
+  Writer out{};
+  out.put(kMagic);
+  out.put(kFormatVersion);
+  out.put(pack.source_hash);
+  out.put(static_cast<uint32_t>(payload.bytes.size()));
+  out.put(payload_hash(payload.bytes.data(), payload.bytes.size()));
+  out.bytes.insert(out.bytes.end(), payload.bytes.begin(), payload.bytes.end());
+  return out.bytes;
+}
+
+// --- Decoding --------------------------------------------------------------------------------
+
+struct Reader {
+  const uint8_t* data = nullptr;
+  size_t size = 0;
+  size_t offset = 0;
+  bool ok = true;
+
+  template <typename T>
+  T get() {
+    T value{};
+    if (!ok || size - offset < sizeof(T)) {
+      ok = false;
+      return value;
+    }
+    std::memcpy(&value, data + offset, sizeof(T));
+    offset += sizeof(T);
+    return value;
+  }
+
+  // Element counts are checked against the bytes left so a corrupt count cannot allocate much.
+  uint32_t get_count(size_t min_element_bytes) {
+    const auto count = get<uint32_t>();
+    if (ok && static_cast<uint64_t>(count) * min_element_bytes > size - offset) ok = false;
+    return ok ? count : 0;
+  }
+
+  std::string get_string() {
+    const uint32_t length = get_count(1);
+    if (!ok) return {};
+    std::string value(reinterpret_cast<const char*>(data + offset), length);
+    offset += length;
+    return value;
+  }
+};
+
+inline bool read_component(Reader& in, Component& c) {
+  const auto kind = in.get<uint8_t>();
+  if (kind > static_cast<uint8_t>(ComponentKind::PeriodicSpawner)) return false;
+  c.kind = static_cast<ComponentKind>(kind);
+  switch (c.kind) {
+    case ComponentKind::Geometry: {
+      const auto type = in.get<uint8_t>();
+      if (type > static_cast<uint8_t>(GeometryType::Polygon)) return false;
+      c.geometry_type = static_cast<GeometryType>(type);
+      const uint32_t count = in.get_count(2 * sizeof(float));
+      c.points.resize(static_cast<size_t>(count) * 2);
+      for (float& value : c.points) value = in.get<float>();
+      break;
+    }
+    case ComponentKind::Color:
+      for (uint8_t& channel : c.color) channel = in.get<uint8_t>();
+      break;
+    case ComponentKind::Layer:
+      c.layer = in.get<int32_t>();
+      break;
+    case ComponentKind::Moving:
+      c.move_x = in.get<float>();
+      c.move_y = in.get<float>();
+      break;
+    case ComponentKind::Rotating:
+      c.angle_random = in.get<uint8_t>();
+      c.angle_value = in.get<float>();
+      c.angle_min = in.get<float>();
+      c.angle_max = in.get<float>();
+      break;
+    case ComponentKind::Collider:
+    case ComponentKind::Trigger:
+      c.handler = in.get<uint32_t>();
+      break;
+    case ComponentKind::PeriodicSpawner:
+      c.spawner_period = in.get<float>();
+      c.spawner_density = in.get<double>();
+      c.spawner_entity = in.get<uint32_t>();
+      break;
+  }
+  return in.ok;
+}
+
+// Returns false (leaving `pack` partially filled) on a wrong magic, version or hash, truncated
+// data or out-of-range references.
+inline bool decode(const uint8_t* data, size_t size, Pack& pack) {
+  pack = Pack{};
+  Reader header{data, size};
+  if (header.get<uint32_t>() != kMagic || header.get<uint32_t>() != kFormatVersion) return false;
+  pack.source_hash = header.get<uint32_t>();
+  const auto payload_size = header.get<uint32_t>();
+  const auto hash = header.get<uint32_t>();
+  if (!header.ok || size - header.offset != payload_size ||
+      payload_hash(data + header.offset, payload_size) != hash) {
+    return false;
+  }
+
+  Reader in{data + header.offset, payload_size};
+  pack.strings.resize(in.get_count(sizeof(uint32_t)));
+  for (auto& value : pack.strings) value = in.get_string();
+
+  pack.entities.resize(in.get_count(3 * sizeof(uint32_t)));
+  for (auto& entity : pack.entities) {
+    entity.name = in.get<uint32_t>();
+    entity.texture = in.get<uint32_t>();
+    entity.root = in.get<uint8_t>();
+    entity.components.resize(in.get_count(1));
+    for (auto& component : entity.components) {
+      if (!read_component(in, component)) return false;
+    }
+  }
+
+  pack.levels.resize(in.get_count(3 * sizeof(uint32_t)));
+  for (auto& level : pack.levels) {
+    level.id = in.get<uint32_t>();
+    level.recipe.resize(in.get_count(2 * sizeof(uint32_t)));
+    for (auto& entry : level.recipe) {
+      entry.type = in.get<uint32_t>();
+      entry.count = in.get<int32_t>();
+    }
+    level.spawns.resize(in.get_count(5 * sizeof(uint32_t)));
+    for (auto& spawn : level.spawns) {
+      spawn.type = in.get<uint32_t>();
+      spawn.template_name = in.get<uint32_t>();
+      spawn.period = in.get<float>();
+      spawn.density = in.get<double>();
+      spawn.total_to_spawn = in.get<int32_t>();
+    }
+  }
+  if (!in.ok || in.offset != payload_size) return false;
+
+  const auto string_ok = [&](uint32_t index) {
+    return index == kNone || index < pack.strings.size();
+  };
+  for (const auto& entity : pack.entities) {
+    if (!string_ok(entity.name) || !string_ok(entity.texture)) return false;
+    for (const auto& component : entity.components) {
+      if (!string_ok(component.handler)) return false;
+      if (component.kind == ComponentKind::PeriodicSpawner &&
+          component.spawner_entity >= pack.entities.size()) {
+        return false;
+      }
+    }
+  }
+  for (const auto& level : pack.levels) {
+    if (!string_ok(level.id)) return false;
+    for (const auto& entry : level.recipe) {
+      if (!string_ok(entry.type)) return false;
+    }
+    for (const auto& spawn : level.spawns) {
+      if (!string_ok(spawn.type) || !string_ok(spawn.template_name)) return false;
+    }
+  }
+  return true;
+}
+
+// Reads the whole file with one read and decodes it.
+inline bool load_file(const std::string& path, Pack& pack) {
+  std::ifstream in(path, std::ios::binary | std::ios::ate);
+  if (!in.is_open()) return false;
+  const std::streamoff size = in.tellg();
+  if (size <= 0) return false;
+  std::vector<uint8_t> bytes(static_cast<size_t>(size));
+  in.seekg(0);
+  if (!in.read(reinterpret_cast<char*>(bytes.data()), size)) return false;
+  if (!decode(bytes.data(), bytes.size(), pack)) {
+    std::cerr << "Ignoring invalid level pack: " << path << std::endl;
+    return false;
+  }
+  return true;
+}
+
+inline Pack cached_pack{};
+inline std::string cached_path{};
+inline bool cached_valid = false;
+
+// Decoded once per path and shared by levels::initialize and level_loader::load_default;
+// nullptr when the pack is missing, invalid or older than levels.data / mushrooms.data, in which
+// case callers parse the text files. Sources that cannot be read leave the pack trusted.
+inline const Pack* load_cached(const std::string& path, const std::string& levels_path,
+                               const std::string& mushrooms_path) {
+  if (path != cached_path) {
+    cached_path = path;
+    cached_valid = load_file(path, cached_pack);
+    uint32_t source_hash = 0;
+    if (cached_valid && hash_sources(levels_path, mushrooms_path, source_hash) &&
+        source_hash != cached_pack.source_hash) {
+      std::cerr << "Ignoring stale level pack: " << path << std::endl;
+      cached_valid = false;
+    }
+  }
+  return cached_valid ? &cached_pack : nullptr;
+}
+
+}  // namespace level_pack
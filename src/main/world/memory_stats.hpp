@@ -0,0 +1,80 @@
+#pragma once
+
+#include <algorithm>
+#include <cstddef>
+#include <iostream>
+
+#include "ecs/ecs.hpp"
+#include "arena_tally.hpp"
+#include "entity_handles.hpp"
+#include "mushroom_pool.hpp"
+#include "vfx.hpp"
+
+// Round-boundary allocation counters. The live component count nets out destroyed entities, so
+// it stays flat even when every event allocates; `allocations` and `bytes` are what went
+// through arena_tally during the previous round. Particles, score popups and spawned mushrooms
+// are pooled, so once the pools are warm those should stay near zero. A round that keeps
+// allocating points at a per-event create that was never pooled.
+namespace memory_stats {
+
+inline constexpr bool kEnableRoundLogging = false;
+
+struct Sample {
+  size_t round = 0;
+  long long components = 0;
+  size_t handle_slots = 0;
+  size_t particles = 0;
+  size_t score_popups = 0;
+  size_t allocations = 0;
+  size_t bytes = 0;
+  size_t parked_mushrooms = 0;
+  size_t reused_mushrooms = 0;
+};
+
+inline Sample last{};
+inline Sample peak{};
+inline size_t rounds_sampled = 0;
+inline size_t allocations_at_round_start = 0;
+inline size_t bytes_at_round_start = 0;
+inline size_t reuses_at_round_start = 0;
+
+inline Sample take_sample() {
+  Sample sample{};
+  sample.round = rounds_sampled;
+  sample.components = static_cast<long long>(ecs::Component::component_count);
+  sample.handle_slots = entity_handles::live_slots();
+  sample.particles = vfx::particle_count();
+  sample.score_popups = vfx::score_deltas_active();
+  sample.allocations = arena_tally::allocations - allocations_at_round_start;
+  sample.bytes = arena_tally::bytes - bytes_at_round_start;
+  sample.parked_mushrooms = mushroom_pool::parked_count();
+  sample.reused_mushrooms = mushroom_pool::reuse_count - reuses_at_round_start;
+  return sample;
+}
+
+inline void on_round_start() {
+  last = take_sample();
+  allocations_at_round_start = arena_tally::allocations;
+  bytes_at_round_start = arena_tally::bytes;
+  reuses_at_round_start = mushroom_pool::reuse_count;
+  peak.components = std::max(peak.components, last.components);
+  peak.handle_slots = std::max(peak.handle_slots, last.handle_slots);
+  peak.particles = std::max(peak.particles, last.particles);
+  peak.score_popups = std::max(peak.score_popups, last.score_popups);
+  peak.allocations = std::max(peak.allocations, last.allocations);
+  peak.bytes = std::max(peak.bytes, last.bytes);
+  peak.parked_mushrooms = std::max(peak.parked_mushrooms, last.parked_mushrooms);
+  peak.reused_mushrooms = std::max(peak.reused_mushrooms, last.reused_mushrooms);
+  peak.round = rounds_sampled;
+  rounds_sampled += 1;
+
+  if constexpr (kEnableRoundLogging) {
+    std::cerr << "[memory] round " << last.round << " components=" << last.components
+              << " (peak " << peak.components << ") handles=" << last.handle_slots
+              << " particles=" << last.particles << " popups=" << last.score_popups
+              << " allocs=" << last.allocations << " (" << last.bytes << " B) parked="
+              << last.parked_mushrooms << " reused=" << last.reused_mushrooms << "\n";
+  }
+}
+
+}  // namespace memory_stats
@@ -40,6 +40,7 @@
 #include "shrooms_screen.hpp"
 #include "shrooms_texture_sizing.hpp"
 #include "shrooms_scenes.hpp"
+#include "sprite_batch.hpp"
 #include "systems/text_input/text_input_system.hpp"
 
 namespace menu {
@@ -265,10 +266,10 @@ inline void apply_menu_background(const std::string& texture_name, bool level_la
   if (!menu_background_sprite || !menu_background_transform) return;
 
   std::string resolved = texture_name.empty() ? kDefaultMenuBackgroundTexture : texture_name;
-  engine::TextureId tex_id = engine::resources::register_texture(resolved);
+  engine::TextureId tex_id = shrooms::acquire_background(resolved);
   if (tex_id == engine::kInvalidTextureId && resolved != kDefaultMenuBackgroundTexture) {
     resolved = kDefaultMenuBackgroundTexture;
-    tex_id = engine::resources::register_texture(resolved);
+    tex_id = shrooms::acquire_background(resolved);
   }
   if (tex_id == engine::kInvalidTextureId) return;
 
@@ -344,13 +345,12 @@ inline void set_line_icon_texture(TextLine& line, const std::string& texture_nam
   const glm::vec2 icon_size =
       shrooms::texture_sizing::from_width_px(texture_name, kMenuLineIconWidthPx);
   if (!line.icon_sprite) {
-    line.icon_sprite = arena::create<render_system::SpriteRenderable>(tex_id, icon_size);
+    // Level emoji and recipe icons live in the sprite atlas.
+    line.icon_sprite = arena::create<sprite_batch::BatchedSprite>(tex_id, icon_size);
     line.icon_entity->add(line.icon_sprite);
   } else {
     line.icon_sprite->texture_id = tex_id;
     line.icon_sprite->size = icon_size;
-    line.icon_sprite->geometry = engine::geometry::make_quad(icon_size.x, icon_size.y);
-    line.icon_sprite->uploaded = false;
   }
 
   line.icon_texture_name = texture_name;
@@ -2148,7 +2148,7 @@ inline void init() {
   bg_transform->pos = glm::vec2{(view_size.x - bg_side) * 0.5f, (view_size.y - bg_side) * 0.5f};
   menu_background->add(bg_transform);
   menu_background->add(arena::create<layers::ConstLayer>(-2));
-  const engine::TextureId bg_tex = engine::resources::register_texture(kDefaultMenuBackgroundTexture);
+  const engine::TextureId bg_tex = shrooms::acquire_background(kDefaultMenuBackgroundTexture);
   menu_background_sprite = arena::create<render_system::SpriteRenderable>(bg_tex, bg_size);
   menu_background->add(menu_background_sprite);
   menu_background_transform = bg_transform;
@@ -1,9 +1,9 @@
 #pragma once
 
-#include "systems/collision/collider_object.hpp"
-#include "utils/callback_registry.hpp"
-
+#include "broadphase.hpp"
 #include "level_manager.hpp"
+#include "mushroom_pool.hpp"
+#include "mushroom_types.hpp"
 #include "player.hpp"
 #include "game_audio.hpp"
 #include "engine/resource_ids.h"
@@ -12,22 +12,18 @@
 
 namespace shrooms {
 
-inline void mushroom_fall_handler(ecs::Entity*, collision::ColliderObject* collider) {
-  if (!collider) return;
-  auto* entity = collider->get_entity();
+inline void mushroom_fall_handler(ecs::Entity*, ecs::Entity* entity) {
   if (!entity || entity->is_pending_deletion()) return;
   if (vfx::is_mushroom_vfx_locked(entity)) return;
-  if (entity->get<player::CarriedMarker>()) return;
-  auto* sprite = entity->get<render_system::SpriteRenderable>();
-  const std::string type = sprite ? engine::resources::texture_name(sprite->texture_id) : "";
-  levels::on_mushroom_missed(type, entity);
+  if (player::is_carried(entity)) return;
+  levels::on_mushroom_missed(mushroom_types::of(entity), entity);
   shrooms::audio::play_mushroom_fall();
   if (!entity->is_pending_deletion() && !vfx::is_mushroom_vfx_locked(entity)) {
-    entity->mark_deleted();
+    mushroom_pool::release(entity);
   }
 }
 
-inline collision::TriggerCallbackRegistry::Registrar mushroom_fall_registrar(
-    "mushroom_fall_handler", mushroom_fall_handler);
+inline broadphase::Registrar mushroom_fall_registrar("mushroom_fall_handler",
+                                                     mushroom_fall_handler);
 
 }  // namespace shrooms
@@ -0,0 +1,151 @@
+#pragma once
+
+#include <cstddef>
+#include <memory>
+#include <unordered_map>
+#include <utility>
+#include <vector>
+
+#include "glm/glm/vec2.hpp"
+
+#include "ecs/ecs.hpp"
+#include "systems/hidden/hidden_object.hpp"
+#include "systems/rotating/rotating_object.hpp"
+#include "systems/transformation/transform_object.hpp"
+
+#include "arena_tally.hpp"
+#include "broadphase.hpp"
+#include "entity_handles.hpp"
+#include "sim_clock.hpp"
+
+// Spawned mushrooms are parked here when they are caught, missed or sorted instead of being
+// destroyed, and the next spawn from the same template takes one back. Parking hides the entity,
+// stops it, disables its collision, moves it off-screen and retires its handles, so bookkeeping
+// that held it (active sets, familiar cargo, deferred reveals) sees it as gone exactly as if it
+// had been deleted.
+// Resetting a reused entity back to its template is the spawner's job (level_loader).
+namespace mushroom_pool {
+
+inline constexpr size_t kMaxParkedPerTemplate = 48;
+inline const glm::vec2 kParkedPos{-10000.0f, -10000.0f};
+
+struct Pooled : public ecs::Component {
+  Pooled(std::shared_ptr<const void> key, ecs::Entity* owner)
+      : ecs::Component(), key(std::move(key)), owner(owner) {}
+  ~Pooled() override;
+
+  // The template the entity was built from; held so its address is never reused as a key.
+  std::shared_ptr<const void> key{};
+  ecs::Entity* owner = nullptr;
+  bool parked = false;
+};
+
+inline std::unordered_map<const void*, std::vector<ecs::Entity*>> parked{};
+inline size_t reuse_count = 0;
+
+inline void set_collision(ecs::Entity* entity, bool enabled) {
+  if (auto* body = entity->get<broadphase::Body>()) body->enabled = enabled;
+  if (auto* sensor = entity->get<broadphase::Sensor>()) sensor->enabled = enabled;
+}
+
+inline void forget(const void* key, ecs::Entity* entity) {
+  auto it = parked.find(key);
+  if (it == parked.end()) return;
+  auto& list = it->second;
+  for (size_t i = 0; i < list.size(); ++i) {
+    if (list[i] != entity) continue;
+    list[i] = list.back();
+    list.pop_back();
+    return;
+  }
+}
+
+// The engine destroyed a parked entity (scene teardown); it must not be handed out again.
+inline Pooled::~Pooled() {
+  if (parked) forget(key.get(), owner);
+  Component::component_count--;
+}
+
+// Tags a freshly built spawn so release() parks it instead of deleting it.
+inline void adopt(ecs::Entity* entity, std::shared_ptr<const void> key) {
+  if (!entity || !key || entity->get<Pooled>()) return;
+  entity->add(arena_tally::create<Pooled>(std::move(key), entity));
+}
+
+// Drop-in for mark_deleted() on mushrooms. Entities that were never adopted, and any past the
+// per-template cap, are deleted as before.
+inline void release(ecs::Entity* entity) {
+  if (!entity || entity->is_pending_deletion()) return;
+  auto* pooled = entity->get<Pooled>();
+  if (!pooled) {
+    entity->mark_deleted();
+    return;
+  }
+  if (pooled->parked) return;
+  auto& list = parked[pooled->key.get()];
+  if (list.size() >= kMaxParkedPerTemplate) {
+    entity->mark_deleted();
+    return;
+  }
+
+  if (auto* hidden = entity->get<hidden::HiddenObject>()) {
+    hidden->hide();
+  }
+  set_collision(entity, false);
+  if (auto* moving = entity->get<sim_clock::FixedStepMover>()) {
+    moving->translate = glm::vec2{0.0f, 0.0f};
+  }
+  if (auto* rotating = entity->get<dynamic::RotatingObject>()) {
+    rotating->angle = 0.0f;
+  }
+  if (auto* transform = entity->get<transform::NoRotationTransform>()) {
+    transform->pos = kParkedPos;
+  }
+  entity_handles::reissue(entity);
+  pooled->parked = true;
+  list.push_back(entity);
+}
+
+inline bool is_parked(const ecs::Entity* entity) {
+  if (!entity) return false;
+  const auto* pooled = entity->get<Pooled>();
+  return pooled && pooled->parked;
+}
+
+// A parked entity built from `key`, or nullptr when there is none to reuse.
+inline ecs::Entity* acquire(const void* key) {
+  auto it = parked.find(key);
+  if (it == parked.end()) return nullptr;
+  auto& list = it->second;
+  while (!list.empty()) {
+    ecs::Entity* entity = list.back();
+    list.pop_back();
+    if (!entity || entity->is_pending_deletion()) continue;
+    if (auto* pooled = entity->get<Pooled>()) {
+      pooled->parked = false;
+    }
+    set_collision(entity, true);
+    ++reuse_count;
+    return entity;
+  }
+  return nullptr;
+}
+
+// Templates were rebuilt (data reload); parked entities keyed by the old ones are deleted.
+inline void clear() {
+  for (auto& [key, list] : parked) {
+    for (auto* entity : list) {
+      if (auto* pooled = entity->get<Pooled>()) pooled->parked = false;
+      if (!entity->is_pending_deletion()) entity->mark_deleted();
+    }
+  }
+  parked.clear();
+}
+
+inline size_t parked_count() {
+  size_t count = 0;
+  for (const auto& [key, list] : parked) count += list.size();
+  return count;
+}
+
+}  // namespace mushroom_pool
@@ -0,0 +1,76 @@
+#pragma once
+
+#include <cstdint>
+#include <string>
+#include <unordered_map>
+#include <utility>
+#include <vector>
+
+#include "ecs/ecs.hpp"
+#include "engine/resource_ids.h"
+#include "systems/render/sprite_system.hpp"
+
+// Mushroom types interned to small dense ids. Level data and spawners intern their type names
+// once at load time and tag every spawned mushroom with a MushroomType, so the catch, miss and
+// sort callbacks index per-type arrays instead of hashing texture-name strings. The name is only
+// looked up again for HUD text and tutorial hooks.
+namespace mushroom_types {
+
+using MushroomTypeId = uint16_t;
+inline constexpr MushroomTypeId kNoType = 0xFFFF;
+
+inline std::vector<std::string> names{};
+inline std::unordered_map<std::string, MushroomTypeId> ids{};
+
+inline MushroomTypeId intern(const std::string& name) {
+  if (name.empty()) return kNoType;
+  const auto it = ids.find(name);
+  if (it != ids.end()) return it->second;
+  const auto id = static_cast<MushroomTypeId>(names.size());
+  names.push_back(name);
+  ids.emplace(name, id);
+  return id;
+}
+
+inline const std::string& name(MushroomTypeId id) {
+  static const std::string empty{};
+  return id < names.size() ? names[id] : empty;
+}
+
+inline size_t count() { return names.size(); }
+
+struct MushroomType : public ecs::Component {
+  explicit MushroomType(MushroomTypeId id) : ecs::Component(), id(id) {}
+  ~MushroomType() override { Component::component_count--; }
+
+  MushroomTypeId id = kNoType;
+};
+
+// Entities spawned outside the level loader (tutorial previews) carry no MushroomType; their
+// texture name is interned on demand.
+inline MushroomTypeId of(ecs::Entity* entity) {
+  if (!entity) return kNoType;
+  if (auto* tagged = entity->get<MushroomType>()) return tagged->id;
+  auto* sprite = entity->get<render_system::SpriteRenderable>();
+  return sprite ? intern(engine::resources::texture_name(sprite->texture_id)) : kNoType;
+}
+
+// Dense per-type storage; ids that were never written read as `fallback`.
+template <typename T>
+struct PerType {
+  explicit PerType(T fallback = T{}) : fallback(std::move(fallback)) {}
+
+  T& operator[](MushroomTypeId id) {
+    if (id >= values.size()) values.resize(static_cast<size_t>(id) + 1, fallback);
+    return values[id];
+  }
+
+  const T& get(MushroomTypeId id) const { return id < values.size() ? values[id] : fallback; }
+
+  void clear() { values.clear(); }
+
+  T fallback{};
+  std::vector<T> values{};
+};
+
+}  // namespace mushroom_types
@@ -13,7 +13,6 @@
 #include "utils/arena.hpp"
 #include "systems/animation/animation_system.hpp"
 #include "systems/animation/sprite_animation.hpp"
-#include "systems/collision/collider_object.hpp"
 #include "systems/color/color_system.hpp"
 #include "systems/geometry/shapes/quad.hpp"
 #include "systems/hidden/hidden_object.hpp"
@@ -23,22 +22,27 @@
 #include "systems/transformation/transform_object.hpp"
 #include "systems/input/input_system.hpp"
 #include "systems/layer/layered_object.hpp"
-#include "systems/moving/moving_object.hpp"
 #include "engine/math.h"
 #include "engine/resource_ids.h"
 #include "ecs/context.hpp"
 #include "systems/scene/scene_system.hpp"
 
+#include "broadphase.hpp"
+#include "entity_handles.hpp"
 #include "level_manager.hpp"
+#include "mushroom_pool.hpp"
+#include "mushroom_types.hpp"
 #include "controls.hpp"
 #include "game_audio.hpp"
 #include "ambient_layers.hpp"
 #include "vfx.hpp"
 #include "camera_shake.hpp"
 #include "score_hud.hpp"
+#include "sim_clock.hpp"
 #include "shrooms_screen.hpp"
 #include "shrooms_texture_sizing.hpp"
 #include "touchscreen.hpp"
+#include "profiler.hpp"
 
 namespace player {
 
@@ -86,12 +90,9 @@ struct PlayerVibe : public dynamic::DynamicObject {
 inline PlayerVibe* player_vibe = nullptr;
 inline struct PlayerController* player_controller = nullptr;
 
-struct CarriedMarker : public ecs::Component {
-  explicit CarriedMarker(ecs::Entity* carrier) : ecs::Component(), carrier(carrier) {}
-  ~CarriedMarker() override { Component::component_count--; }
-
-  ecs::Entity* carrier = nullptr;
-};
+// True while a familiar holds `mushroom`. Asked of the familiars' own handles rather than a
+// marker component, so a pooled mushroom parked mid-carry comes back uncarried.
+inline bool is_carried(const ecs::Entity* mushroom);
 
 inline void kick_recoil(float amount) {
   if (!player_vibe) return;
@@ -231,6 +232,7 @@ struct FamiliarLogic : public dynamic::DynamicObject {
   ~FamiliarLogic() override { Component::component_count--; }
 
   void update() override {
+    SHROOMS_PROFILE_ZONE("FamiliarLogic");
     if (scene::is_current_scene_paused()) return;
 
     if (!transform) {
@@ -240,7 +242,7 @@ struct FamiliarLogic : public dynamic::DynamicObject {
 
     const float dt = static_cast<float>(ecs::context().delta_seconds);
 
-    if (carried && carried->is_pending_deletion()) {
+    if (!carried.empty() && !carried.get()) {
       clear_carried(false);
       begin_return();
     }
@@ -305,7 +307,7 @@ struct FamiliarLogic : public dynamic::DynamicObject {
 
   bool is_idle() const { return state == FamiliarState::Ready; }
 
-  bool can_capture() const { return state == FamiliarState::Planted && !carried; }
+  bool can_capture() const { return state == FamiliarState::Planted && carried.empty(); }
 
   bool can_strike_hit() const { return state == FamiliarState::StrikeAscend; }
 
@@ -336,9 +338,8 @@ struct FamiliarLogic : public dynamic::DynamicObject {
     if (!mushroom || mushroom->is_pending_deletion()) return;
     if (vfx::is_mushroom_vfx_locked(mushroom)) return;
     if (!can_capture()) return;
-    if (mushroom->get<CarriedMarker>()) return;
+    if (is_carried(mushroom)) return;
 
-    mushroom->add(arena::create<CarriedMarker>(entity));
     carried = mushroom;
     carried_transform = mushroom->get<transform::NoRotationTransform>();
     carried_size = vfx::entity_size(mushroom);
@@ -346,7 +347,7 @@ struct FamiliarLogic : public dynamic::DynamicObject {
       carried_size = size * 0.8f;
     }
 
-    if (auto* moving = mushroom->get<dynamic::MovingObject>()) {
+    if (auto* moving = mushroom->get<sim_clock::FixedStepMover>()) {
       moving->translate = glm::vec2{0.0f, 0.0f};
     }
 
@@ -379,9 +380,11 @@ struct FamiliarLogic : public dynamic::DynamicObject {
   }
 
   void clear_carried(bool delete_entity) {
-    if (!carried) return;
+    if (carried.empty()) return;
     if (delete_entity) {
-      carried->mark_deleted();
+      if (auto* mushroom = carried.get()) {
+        mushroom_pool::release(mushroom);
+      }
     }
     carried = nullptr;
     carried_transform = nullptr;
@@ -389,7 +392,8 @@ struct FamiliarLogic : public dynamic::DynamicObject {
   }
 
   void deliver() {
-    if (!carried || carried->is_pending_deletion()) {
+    auto* mushroom = carried.get();
+    if (!mushroom) {
       clear_carried(false);
       begin_return();
       return;
@@ -405,9 +409,7 @@ struct FamiliarLogic : public dynamic::DynamicObject {
       }
     }
 
-    auto* sprite = carried->get<render_system::SpriteRenderable>();
-    const std::string type = sprite ? engine::resources::texture_name(sprite->texture_id) : "";
-    levels::on_mushroom_caught(type, carried, catch_center, true);
+    levels::on_mushroom_caught(mushroom_types::of(mushroom), mushroom, catch_center, true);
     clear_carried(false);
     begin_return();
   }
@@ -437,7 +439,7 @@ struct FamiliarLogic : public dynamic::DynamicObject {
   }
 
   void update_carried_position() {
-    if (!carried || !carried_transform) return;
+    if (!carried.get() || !carried_transform) return;
     const glm::vec2 target_center =
         current_center() + glm::vec2{0.0f, size.y * 0.35f};
     carried_transform->pos = target_center - carried_size * 0.5f;
@@ -648,7 +650,7 @@ struct FamiliarLogic : public dynamic::DynamicObject {
   glm::vec2 sink_start{0.0f, 0.0f};
   glm::vec2 sink_target{0.0f, 0.0f};
   FamiliarState state = FamiliarState::Ready;
-  ecs::Entity* carried = nullptr;
+  entity_handles::Handle carried{};
   transform::NoRotationTransform* carried_transform = nullptr;
   glm::vec2 carried_size{0.0f, 0.0f};
 };
@@ -658,6 +660,14 @@ inline std::array<ecs::Entity*, kFamiliarCount> familiar_entities{};
 inline std::array<FamiliarLogic*, kFamiliarCount> familiar_logic{};
 inline glm::vec2 familiar_size{0.0f, 0.0f};
 
+inline bool is_carried(const ecs::Entity* mushroom) {
+  if (!mushroom) return false;
+  for (auto* logic : familiar_logic) {
+    if (logic && logic->carried.is(mushroom)) return true;
+  }
+  return false;
+}
+
 inline int ready_familiar_count() {
   int count = 0;
   for (auto* logic : familiar_logic) {
@@ -695,25 +705,23 @@ inline void launch_strike_familiar() {
   }
 }
 
-inline collision::TriggerObject* make_familiar_trigger(FamiliarLogic* logic) {
-  return arena::create<collision::TriggerObject>(
-      "mushroom_catch_handler",
-      [logic](ecs::Entity*, collision::ColliderObject* collider) {
-        if (!logic || !collider) return;
+inline broadphase::Sensor* make_familiar_trigger(FamiliarLogic* logic) {
+  return arena::create<broadphase::Sensor>(
+      broadphase::kCatch, familiar_size,
+      [logic](ecs::Entity*, ecs::Entity* entity) {
+        if (!logic) return;
         if (!logic->can_capture()) return;
-        auto* entity = collider->get_entity();
         if (!entity || entity->is_pending_deletion()) return;
         if (vfx::is_mushroom_vfx_locked(entity)) return;
         logic->handle_capture(entity);
       });
 }
 
-inline collision::TriggerObject* make_familiar_sort_trigger(FamiliarLogic* logic) {
-  return arena::create<collision::TriggerObject>(
-      "bone_projectile_handler",
-      [logic](ecs::Entity*, collision::ColliderObject* collider) {
-        if (!logic || !collider) return;
-        auto* entity = collider->get_entity();
+inline broadphase::Sensor* make_familiar_sort_trigger(FamiliarLogic* logic) {
+  return arena::create<broadphase::Sensor>(
+      broadphase::kStrike, familiar_size,
+      [logic](ecs::Entity*, ecs::Entity* entity) {
+        if (!logic) return;
         if (!entity || entity->is_pending_deletion()) return;
         if (vfx::is_mushroom_vfx_locked(entity)) return;
         logic->handle_strike_hit(entity);
@@ -878,6 +886,7 @@ struct PlayerController : public dynamic::DynamicObject {
   ~PlayerController() override { Component::component_count--; }
 
   void update() override {
+    SHROOMS_PROFILE_ZONE("PlayerController");
     if (scene::is_current_scene_paused()) return;
     if (!player_transform) return;
 
@@ -907,21 +916,27 @@ struct PlayerController : public dynamic::DynamicObject {
       if (std::abs(dx) > 0.001f) {
         flash_blocked_movement();
       }
-      dust_timer = 0.0f;
-      return;
+      dx = 0.0f;
+    }
+
+    // step_px is per sim tick; input is sampled once per frame and held for its ticks.
+    sim_clock::sync();
+    position.absorb(player_transform->pos);
+    const float min_x = 0.0f;
+    const float max_x = static_cast<float>(shrooms::screen::view_width) - player_size.x;
+    for (int i = 0; i < sim_clock::steps; ++i) {
+      float next_x = position.current.x + dx;
+      if (next_x < min_x) next_x = min_x;
+      if (next_x > max_x) next_x = max_x;
+      position.step(glm::vec2{next_x - position.current.x, 0.0f});
     }
+    player_transform->pos = position.present();
 
     if (dx == 0.0f) {
       dust_timer = 0.0f;
       return;
     }
 
-    player_transform->pos.x += dx;
-    const float min_x = 0.0f;
-    const float max_x = static_cast<float>(shrooms::screen::view_width) - player_size.x;
-    if (player_transform->pos.x < min_x) player_transform->pos.x = min_x;
-    if (player_transform->pos.x > max_x) player_transform->pos.x = max_x;
-
     spawn_dash_dust(dx);
 
     if (player_anim) {
@@ -956,23 +971,21 @@ struct PlayerController : public dynamic::DynamicObject {
   }
 
   float step_px = 0.0f;
+  sim_clock::InterpolatedPosition position{};
   float dust_timer = 0.0f;
   float dust_period = 0.08f;
   bool deploy_pressed_last = false;
   bool fire_pressed_last = false;
 };
 
-inline collision::TriggerObject* make_player_trigger() {
-  return arena::create<collision::TriggerObject>(
-      "mushroom_catch_handler",
-      [](ecs::Entity*, collision::ColliderObject* collider) {
-        if (!collider) return;
-        auto* entity = collider->get_entity();
+inline broadphase::Sensor* make_player_trigger() {
+  return arena::create<broadphase::Sensor>(
+      broadphase::kCatch, player_size,
+      [](ecs::Entity*, ecs::Entity* entity) {
         if (!entity || entity->is_pending_deletion()) return;
         if (vfx::is_mushroom_vfx_locked(entity)) return;
-        if (entity->get<CarriedMarker>()) return;
-        auto* sprite = entity->get<render_system::SpriteRenderable>();
-        const std::string type = sprite ? engine::resources::texture_name(sprite->texture_id) : "";
+        if (is_carried(entity)) return;
+        const mushroom_types::MushroomTypeId type = mushroom_types::of(entity);
         const float nan = std::numeric_limits<float>::quiet_NaN();
         glm::vec2 catch_center{nan, nan};
         if (player_transform) {
@@ -1012,7 +1025,8 @@ inline void init() {
 
   const engine::TextureId tex_id =
       engine::resources::register_texture("witch_right_1");
-  player_entity->add(arena::create<render_system::SpriteRenderable>(tex_id, player_size));
+  player_entity->add(
+      arena::create<camera_shake::Shaken<render_system::SpriteRenderable>>(tex_id, player_size));
   player_color = arena::create<color::OneColor>(glm::vec4{1.0f, 1.0f, 1.0f, 1.0f});
   player_entity->add(player_color);
 
@@ -0,0 +1,137 @@
+#pragma once
+
+#include <string>
+
+#include "utils/arena.hpp"
+
+// Scoped timing zones exported as a Chrome trace (chrome://tracing, Perfetto). Only compiled in
+// when the build defines SHROOMS_PROFILE (cmake -DSHROOMS_PROFILE=ON); otherwise the zone macro
+// is empty and profiler::create_system is a plain arena::create. Native builds write the trace
+// on exit to SHROOMS_TRACE_PATH (default shrooms_trace.json); web builds offer it as a download
+// through shrooms_profile_download().
+#ifdef SHROOMS_PROFILE
+
+#include <chrono>
+#include <cstdint>
+#include <cstdlib>
+#include <fstream>
+#include <iostream>
+#include <sstream>
+#include <vector>
+
+namespace profiler {
+
+// Caps memory on long sessions; later zones are dropped and counted.
+inline constexpr size_t kMaxEvents = 1u << 20;
+
+struct Event {
+  const char* name = nullptr;
+  int64_t start_us = 0;
+  int64_t duration_us = 0;
+};
+
+inline std::vector<Event> events{};
+inline size_t dropped_events = 0;
+
+inline int64_t now_us() {
+  static const auto origin = std::chrono::steady_clock::now();
+  return std::chrono::duration_cast<std::chrono::microseconds>(
+             std::chrono::steady_clock::now() - origin)
+      .count();
+}
+
+struct Zone {
+  explicit Zone(const char* name) : name(name), start_us(now_us()) {}
+  ~Zone() {
+    if (events.size() >= kMaxEvents) {
+      ++dropped_events;
+      return;
+    }
+    if (events.empty()) events.reserve(4096);
+    events.push_back(Event{name, start_us, now_us() - start_us});
+  }
+  Zone(const Zone&) = delete;
+  Zone& operator=(const Zone&) = delete;
+
+  const char* name;
+  int64_t start_us;
+};
+
+// Wraps an engine system so its update() is timed without touching engine code.
+template <typename System>
+struct Zoned : public System {
+  explicit Zoned(const char* zone_name) : System(), zone_name(zone_name) {}
+
+  void update() override {
+    Zone zone{zone_name};
+    System::update();
+  }
+
+  const char* zone_name;
+};
+
+template <typename System>
+inline System* create_system(const char* zone_name) {
+  return arena::create<Zoned<System>>(zone_name);
+}
+
+inline std::string trace_json() {
+  std::ostringstream out;
+  out << "{\"traceEvents\":[";
+  for (size_t i = 0; i < events.size(); ++i) {
+    const auto& event = events[i];
+    if (i > 0) out << ',';
+    out << "{\"name\":\"" << event.name << "\",\"ph\":\"X\",\"pid\":1,\"tid\":1,\"ts\":"
+        << event.start_us << ",\"dur\":" << event.duration_us << '}';
+  }
+  out << "],\"displayTimeUnit\":\"ms\",\"otherData\":{\"dropped_events\":" << dropped_events
+      << "}}";
+  return out.str();
+}
+
+#ifndef __EMSCRIPTEN__
+inline void write_trace_on_exit() {
+  const char* env_path = std::getenv("SHROOMS_TRACE_PATH");
+  const std::string path = env_path && *env_path ? env_path : "shrooms_trace.json";
+  std::ofstream file(path, std::ios::out | std::ios::trunc);
+  if (!file) {
+    std::cerr << "profiler: failed to open " << path << "\n";
+    return;
+  }
+  file << trace_json();
+  std::cerr << "profiler: wrote " << events.size() << " zones to " << path << "\n";
+}
+#endif
+
+inline void init() {
+#ifndef __EMSCRIPTEN__
+  static bool registered = false;
+  if (registered) return;
+  registered = true;
+  std::atexit(write_trace_on_exit);
+#endif
+}
+
+}  // namespace profiler
+
+#define SHROOMS_PROFILE_CONCAT_INNER(a, b) a##b
+#define SHROOMS_PROFILE_CONCAT(a, b) SHROOMS_PROFILE_CONCAT_INNER(a, b)
+#define SHROOMS_PROFILE_ZONE(name) \
+  ::profiler::Zone SHROOMS_PROFILE_CONCAT(shrooms_profile_zone_, __LINE__) { name }
+
+#else
+
+namespace profiler {
+
+template <typename System>
+inline System* create_system(const char*) {
+  return arena::create<System>();
+}
+
+inline void init() {}
+
+}  // namespace profiler
+
+#define SHROOMS_PROFILE_ZONE(name) ((void)0)
+
+#endif
@@ -0,0 +1,208 @@
+#pragma once
+
+#include <cstdint>
+#include <fstream>
+#include <iostream>
+#include <span>
+#include <sstream>
+#include <string>
+#include <utility>
+#include <vector>
+
+#include "engine/input.h"
+
+// Recorded daily infinite runs. A replay pins everything the run depends on besides code: the
+// daily date and seed, the game mode, key bindings, the spawn governor caps, the sim clock phase
+// at the first tick, the delta of every tick and every input event with the tick it arrived on.
+// Playing it back on the headless driver reproduces the run tick for tick, which also makes heavy
+// real runs usable as profiling fixtures.
+//
+// The file is line based text:
+//   shrooms_replay <version>
+//   date <YYYY-MM-DD>
+//   seed <daily seed>
+//   mode collector|recipe
+//   bindings <key> <key> ...
+//   governor <live per type> <live total>   absent in older files: unlimited
+//   clock <time_seconds> <sim accumulator>
+//   dt <tick count> <seconds>          run-length encoded tick deltas
+//   ev <tick> <kind> <key> <x> <y> <pointer id> <ctrl>
+//   end <ticks> <score>
+namespace replay {
+
+inline constexpr int kFormatVersion = 1;
+
+struct Event {
+  uint64_t tick = 0;
+  engine::InputEvent event{};
+};
+
+struct DeltaRun {
+  uint64_t ticks = 0;
+  double seconds = 0.0;
+};
+
+struct Replay {
+  std::string date{};
+  uint32_t seed = 0;
+  std::string mode = "collector";
+  std::vector<int> bindings{};
+  float max_live_per_type = 0.0f;
+  float max_live_total = 0.0f;
+  double start_time_seconds = 0.0;
+  double start_accumulator = 0.0;
+  std::vector<DeltaRun> deltas{};
+  std::vector<Event> events{};
+  uint64_t ticks = 0;
+  int score = 0;
+  bool finished = false;
+
+  // One delta per recorded tick.
+  std::vector<double> tick_deltas() const {
+    std::vector<double> out;
+    out.reserve(static_cast<size_t>(ticks));
+    for (const auto& run : deltas) {
+      out.insert(out.end(), static_cast<size_t>(run.ticks), run.seconds);
+    }
+    return out;
+  }
+};
+
+inline bool save(const Replay& replay, const std::string& path) {
+  std::ofstream out(path, std::ios::out | std::ios::trunc);
+  if (!out) {
+    std::cerr << "replay: failed to open " << path << std::endl;
+    return false;
+  }
+  out.precision(17);
+  out << "shrooms_replay " << kFormatVersion << "\n";
+  out << "date " << replay.date << "\n";
+  out << "seed " << replay.seed << "\n";
+  out << "mode " << replay.mode << "\n";
+  out << "bindings";
+  for (int key : replay.bindings) out << ' ' << key;
+  out << "\n";
+  out << "governor " << replay.max_live_per_type << ' ' << replay.max_live_total << "\n";
+  out << "clock " << replay.start_time_seconds << ' ' << replay.start_accumulator << "\n";
+  for (const auto& run : replay.deltas) {
+    out << "dt " << run.ticks << ' ' << run.seconds << "\n";
+  }
+  for (const auto& entry : replay.events) {
+    const auto& e = entry.event;
+    out << "ev " << entry.tick << ' ' << static_cast<int>(e.kind) << ' ' << e.key_code << ' '
+        << e.x << ' ' << e.y << ' ' << e.pointer_id << ' ' << (e.ctrl ? 1 : 0) << "\n";
+  }
+  out << "end " << replay.ticks << ' ' << replay.score << "\n";
+  return true;
+}
+
+inline bool load(const std::string& path, Replay& replay) {
+  std::ifstream in(path);
+  if (!in.is_open()) {
+    std::cerr << "replay: failed to open " << path << std::endl;
+    return false;
+  }
+  replay = Replay{};
+  std::string line;
+  bool header_seen = false;
+  while (std::getline(in, line)) {
+    if (line.empty() || line[0] == '#') continue;
+    std::istringstream fields(line);
+    std::string tag;
+    fields >> tag;
+    if (tag == "shrooms_replay") {
+      int version = 0;
+      fields >> version;
+      if (version != kFormatVersion) {
+        std::cerr << "replay: unsupported version " << version << " in " << path << std::endl;
+        return false;
+      }
+      header_seen = true;
+    } else if (tag == "date") {
+      fields >> replay.date;
+    } else if (tag == "seed") {
+      fields >> replay.seed;
+    } else if (tag == "mode") {
+      fields >> replay.mode;
+    } else if (tag == "bindings") {
+      int key = 0;
+      while (fields >> key) replay.bindings.push_back(key);
+    } else if (tag == "governor") {
+      fields >> replay.max_live_per_type >> replay.max_live_total;
+    } else if (tag == "clock") {
+      fields >> replay.start_time_seconds >> replay.start_accumulator;
+    } else if (tag == "dt") {
+      DeltaRun run{};
+      if (fields >> run.ticks >> run.seconds) replay.deltas.push_back(run);
+    } else if (tag == "ev") {
+      Event entry{};
+      int kind = 0;
+      int ctrl = 0;
+      auto& e = entry.event;
+      if (!(fields >> entry.tick >> kind >> e.key_code >> e.x >> e.y >> e.pointer_id >> ctrl)) {
+        continue;
+      }
+      e.kind = static_cast<engine::InputKind>(kind);
+      e.ctrl = ctrl != 0;
+      replay.events.push_back(entry);
+    } else if (tag == "end") {
+      fields >> replay.ticks >> replay.score;
+      replay.finished = true;
+    }
+  }
+  if (!header_seen) {
+    std::cerr << "replay: missing header in " << path << std::endl;
+    return false;
+  }
+  return true;
+}
+
+// Captures ticks after `arm()` has been called; the tick that started the run (and the menu
+// input that caused it) is skipped because playback starts the run directly.
+struct Recorder {
+  void arm(Replay header) {
+    replay = std::move(header);
+    armed = true;
+    recording = false;
+  }
+
+  bool active() const { return armed || recording; }
+
+  // `accumulator` is the sim clock remainder after this tick's sync.
+  void record_tick(double time_seconds, double delta_seconds,
+                   std::span<const engine::InputEvent> events, double accumulator) {
+    if (armed) {
+      armed = false;
+      recording = true;
+      replay.start_accumulator = accumulator;
+      return;
+    }
+    if (!recording) return;
+    if (replay.ticks == 0) replay.start_time_seconds = time_seconds;
+    if (!replay.deltas.empty() && replay.deltas.back().seconds == delta_seconds) {
+      replay.deltas.back().ticks += 1;
+    } else {
+      replay.deltas.push_back(DeltaRun{1, delta_seconds});
+    }
+    for (const auto& e : events) {
+      replay.events.push_back(Event{replay.ticks, e});
+    }
+    replay.ticks += 1;
+  }
+
+  void finish(int score, const std::string& path) {
+    if (!recording) return;
+    recording = false;
+    replay.score = score;
+    replay.finished = true;
+    if (save(replay, path)) {
+      std::cerr << "replay: wrote " << replay.ticks << " ticks to " << path << std::endl;
+    }
+  }
+
+  Replay replay{};
+  bool armed = false;
+  bool recording = false;
+};
+
+}  // namespace replay
@@ -0,0 +1,56 @@
+#pragma once
+
+#include <cstdint>
+
+// Independent random streams. Anything that can change a run's outcome (spawn parameters, mushroom
+// wobble) draws from `gameplay`; particles, ambient motion and shake phases draw from `cosmetic`;
+// sound variation draws from `audio`. Both gameplay and cosmetic are reseeded from the level seed at
+// every level start, so replays and daily runs repeat exactly and cosmetic settings can draw more or
+// fewer numbers without shifting the gameplay sequence.
+namespace rng_streams {
+
+// PCG32 (XSH RR): 8 bytes of state, a handful of instructions per draw.
+struct Stream {
+  explicit Stream(uint64_t seed_value = 0x853c49e6748fea9bull) { seed(seed_value); }
+
+  void seed(uint64_t seed_value) {
+    state = 0;
+    next_u32();
+    state += seed_value;
+    next_u32();
+  }
+
+  uint32_t next_u32() {
+    const uint64_t old = state;
+    state = old * 6364136223846793005ull + kIncrement;
+    const auto xorshifted = static_cast<uint32_t>(((old >> 18u) ^ old) >> 27u);
+    const auto rot = static_cast<uint32_t>(old >> 59u);
+    return (xorshifted >> rot) | (xorshifted << ((32u - rot) & 31u));
+  }
+
+  // Uniform in [lo, hi).
+  double get_double(double lo, double hi) {
+    return lo + (hi - lo) * (static_cast<double>(next_u32()) * (1.0 / 4294967296.0));
+  }
+
+  // Uniform in [lo, hi], matching rnd::get_int.
+  int get_int(int lo, int hi) {
+    if (hi <= lo) return lo;
+    const auto span = static_cast<uint64_t>(static_cast<int64_t>(hi) - lo + 1);
+    return lo + static_cast<int>((static_cast<uint64_t>(next_u32()) * span) >> 32u);
+  }
+
+  static constexpr uint64_t kIncrement = 1442695040888963407ull;
+  uint64_t state = 0;
+};
+
+inline Stream gameplay{0x9e3779b97f4a7c15ull};
+inline Stream cosmetic{0xbf58476d1ce4e5b9ull};
+inline Stream audio{0x8c2f3a1dull};
+
+inline void seed_for_level(uint32_t level_seed) {
+  gameplay.seed(level_seed);
+  cosmetic.seed(static_cast<uint64_t>(level_seed) ^ 0x94d049bb133111ebull);
+}
+
+}  // namespace rng_streams
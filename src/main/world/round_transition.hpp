@@ -10,7 +10,6 @@
 #include "ecs/ecs.hpp"
 #include "ecs/context.hpp"
 #include "utils/arena.hpp"
-#include "utils/random.hpp"
 #include "systems/color/color_system.hpp"
 #include "systems/dynamic/dynamic_object.hpp"
 #include "systems/hidden/hidden_object.hpp"
@@ -21,6 +20,7 @@
 #include "systems/text/text_object.hpp"
 #include "systems/transformation/transform_object.hpp"
 
+#include "rng_streams.hpp"
 #include "shrooms_screen.hpp"
 #include "vfx.hpp"
 
@@ -113,19 +113,20 @@ inline void update_text_layout(const std::string& value) {
 }
 
 inline void spawn_ambient_spores() {
+  auto& rng = rng_streams::cosmetic;
   if (config.ambient_spores <= 0) return;
   const float width = static_cast<float>(shrooms::screen::view_width);
   const float height = static_cast<float>(shrooms::screen::view_height);
   for (int i = 0; i < config.ambient_spores; ++i) {
-    const float x = static_cast<float>(rnd::get_double(0.0, width));
-    const float y = static_cast<float>(rnd::get_double(height * 0.2, height * 0.85));
+    const float x = static_cast<float>(rng.get_double(0.0, width));
+    const float y = static_cast<float>(rng.get_double(height * 0.2, height * 0.85));
     vfx::SporeConfig spore{};
     spore.color = config.ambient_color;
     spore.lifetime =
-        static_cast<float>(rnd::get_double(config.ambient_lifetime * 0.8,
-                                           config.ambient_lifetime * 1.2));
+        static_cast<float>(rng.get_double(config.ambient_lifetime * 0.8,
+                                          config.ambient_lifetime * 1.2));
     spore.start_radius =
-        static_cast<float>(rnd::get_double(config.ambient_min_radius, config.ambient_max_radius));
+        static_cast<float>(rng.get_double(config.ambient_min_radius, config.ambient_max_radius));
     spore.end_radius = spore.start_radius * 2.2f;
     spore.velocity = glm::vec2{0.0f, -config.ambient_speed};
     spore.layer = config.ambient_layer;
@@ -184,8 +185,9 @@ inline void start_round_win(int current_round, int next_round,
   start_transition(message, std::move(done), std::move(covered));
 }
 
-inline void start_level_completed(std::function<void()> done = nullptr) {
-  start_transition("level completed", std::move(done));
+inline void start_level_completed(std::function<void()> done = nullptr,
+                                  std::function<void()> covered = nullptr) {
+  start_transition("level completed", std::move(done), std::move(covered));
 }
 
 inline bool is_active() { return active; }
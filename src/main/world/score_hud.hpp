@@ -23,10 +23,10 @@
 #include "systems/scene/scene_object.hpp"
 #include "systems/text/text_object.hpp"
 #include "systems/transformation/transform_object.hpp"
-#include "engine/geometry_builder.h"
 
 #include "shrooms_screen.hpp"
 #include "shrooms_texture_sizing.hpp"
+#include "sprite_batch.hpp"
 
 namespace score_hud {
 
@@ -159,8 +159,6 @@ inline void update_lives_layout() {
     }
     if (life_heart_sprites[i]) {
       life_heart_sprites[i]->size = heart_size;
-      life_heart_sprites[i]->geometry = engine::geometry::make_quad(heart_size.x, heart_size.y);
-      life_heart_sprites[i]->uploaded = false;
     }
     if (life_heart_hidden[i]) {
       life_heart_hidden[i]->set_visible(lives_visible && static_cast<int>(i) < visible_hearts);
@@ -187,8 +185,6 @@ inline void update_bat_layout() {
     }
     if (bat_icon_sprites[i]) {
       bat_icon_sprites[i]->size = bat_size;
-      bat_icon_sprites[i]->geometry = engine::geometry::make_quad(bat_size.x, bat_size.y);
-      bat_icon_sprites[i]->uploaded = false;
     }
     if (bat_icon_colors[i]) {
       const bool ready = static_cast<int>(i) < ready_bats;
@@ -348,7 +344,7 @@ inline void reset_hud() {
     life_heart_entities[i]->add(arena::create<layers::ConstLayer>(config.layer + 1));
     const engine::TextureId tex_id = engine::resources::register_texture("heart");
     const glm::vec2 size = shrooms::texture_sizing::from_width_px("heart", 18.0f);
-    life_heart_sprites[i] = arena::create<render_system::SpriteRenderable>(tex_id, size);
+    life_heart_sprites[i] = arena::create<sprite_batch::BatchedSprite>(tex_id, size);
     life_heart_entities[i]->add(life_heart_sprites[i]);
     life_heart_hidden[i] = arena::create<hidden::HiddenObject>();
     life_heart_entities[i]->add(life_heart_hidden[i]);
@@ -367,7 +363,7 @@ inline void reset_hud() {
     bat_icon_entities[i]->add(arena::create<layers::ConstLayer>(config.layer + 1));
     const engine::TextureId tex_id = engine::resources::register_texture("famiriar");
     const glm::vec2 size = shrooms::texture_sizing::from_width_px("famiriar", 14.0f);
-    bat_icon_sprites[i] = arena::create<render_system::SpriteRenderable>(tex_id, size);
+    bat_icon_sprites[i] = arena::create<sprite_batch::BatchedSprite>(tex_id, size);
     bat_icon_entities[i]->add(bat_icon_sprites[i]);
     bat_icon_colors[i] = arena::create<color::OneColor>(glm::vec4{1.0f});
     bat_icon_entities[i]->add(bat_icon_colors[i]);
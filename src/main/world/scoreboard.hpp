@@ -3,7 +3,6 @@
 #include <algorithm>
 #include <cmath>
 #include <string>
-#include <unordered_map>
 #include <utility>
 #include <vector>
 
@@ -21,8 +20,11 @@
 #include "systems/text/text_object.hpp"
 #include "systems/transformation/transform_object.hpp"
 
+#include "mushroom_types.hpp"
 #include "shrooms_screen.hpp"
 #include "shrooms_texture_sizing.hpp"
+#include "sprite_batch.hpp"
+#include "profiler.hpp"
 
 namespace scoreboard {
 
@@ -60,7 +62,8 @@ struct Entry {
 };
 
 inline std::vector<Entry> entries{};
-inline std::unordered_map<std::string, size_t> entry_index{};
+inline constexpr size_t kNoEntry = static_cast<size_t>(-1);
+inline mushroom_types::PerType<size_t> entry_index{kNoEntry};
 inline std::vector<std::pair<std::string, int>> current_recipe{};
 inline std::string objective_word{};
 inline ecs::Entity* panel = nullptr;
@@ -221,7 +224,7 @@ inline ecs::Entity* create_sprite(const std::string& texture_name, const glm::ve
   entity->add(transform);
   entity->add(arena::create<layers::ConstLayer>(layer));
   const engine::TextureId tex_id = engine::resources::register_texture(texture_name);
-  entity->add(arena::create<render_system::SpriteRenderable>(tex_id, size));
+  entity->add(arena::create<sprite_batch::BatchedSprite>(tex_id, size));
   entity->add(arena::create<scene::SceneObject>("main"));
   return entity;
 }
@@ -292,7 +295,10 @@ inline void rebuild_entries() {
     entry.target = current_recipe[i].second;
     entry.current = 0;
     create_entry_visuals(entry, i);
-    entry_index[entry.name] = entries.size();
+    const auto type = mushroom_types::intern(entry.name);
+    if (type != mushroom_types::kNoType) {
+      entry_index[type] = entries.size();
+    }
     entries.push_back(entry);
   }
 }
@@ -311,15 +317,19 @@ inline void init_with_targets(const std::vector<std::pair<std::string, int>>& re
   apply_layout();
 }
 
-inline void update_score(const std::string& name, int new_score, int target) {
-  auto it = entry_index.find(name);
-  if (it == entry_index.end()) return;
-  auto& entry = entries[it->second];
+inline void update_score(mushroom_types::MushroomTypeId type, int new_score, int target) {
+  const size_t index = entry_index.get(type);
+  if (index == kNoEntry) return;
+  auto& entry = entries[index];
   entry.current = new_score;
   entry.target = target;
   update_entry_text(entry);
 }
 
+inline void update_score(const std::string& name, int new_score, int target) {
+  update_score(mushroom_types::intern(name), new_score, target);
+}
+
 inline void set_layout(LayoutState state) {
   layout_state = state;
   animation_active = false;
@@ -382,6 +392,7 @@ struct ScoreboardController : public dynamic::DynamicObject {
   ~ScoreboardController() override { Component::component_count--; }
 
   void update() override {
+    SHROOMS_PROFILE_ZONE("ScoreboardController");
     const float dt = static_cast<float>(ecs::context().delta_seconds);
     bool dirty = false;
 
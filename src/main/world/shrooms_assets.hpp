@@ -1,9 +1,17 @@
 #pragma once
 
+#include <array>
+#include <fstream>
+#include <iostream>
 #include <string>
+#include <unordered_set>
 
 #include "engine/resource_ids.h"
+#include "utils/file_system.hpp"
+
 #include "shrooms_texture_sizing.hpp"
+#include "sprite_batch.hpp"
+#include "svg_raster_cache.hpp"
 
 namespace shrooms {
 
@@ -22,12 +30,79 @@ inline std::string asset_path(const std::string& name) {
 #endif
 }
 
+// Generated by the shrooms_sprite_atlas target (src/tools/svg_atlas.cpp). Members are only ever
+// drawn through sprite_batch::BatchedSprite, which resolves them to their atlas cell, so they are
+// not rasterized on their own unless the manifest is missing them. The member list is shared
+// with CMakeLists.txt through sprite_atlas_members.inc.
+inline constexpr const char* kSpriteAtlasName = "sprite_atlas";
+inline constexpr const char* kSpriteAtlasMembers[] = {
+#include "sprite_atlas_members.inc"
+};
+
+// Uses the baked PNG when shrooms::raster_cache has a current one, else rasterizes the SVG.
+inline void register_svg_or_cached(const std::string& name, float width_ratio) {
+  if (raster_cache::try_register(name, width_ratio)) return;
+  engine::resources::register_svg_texture(name, width_ratio);
+}
+
+inline void register_svg_at_reference_width(const std::string& name) {
+  const glm::vec2 size = shrooms::texture_sizing::reference_size(name);
+  register_svg_or_cached(name, width_ratio_from_reference(size.x));
+}
+
+// Level backgrounds are screen-sized and only one is on screen at a time, so they are
+// rasterized on first use instead of at startup. engine::resources has no call to release a
+// registered texture, so a loaded background stays resident.
+inline constexpr const char* kMenuBackgroundName = "background";
+inline std::unordered_set<std::string> loaded_backgrounds{};
+
+inline void prefetch_background(const std::string& name) {
+  if (name.empty() || loaded_backgrounds.contains(name)) return;
+  register_svg_at_reference_width(name);
+  loaded_backgrounds.insert(name);
+}
+
+inline engine::TextureId acquire_background(const std::string& name) {
+  prefetch_background(name);
+  return engine::resources::register_texture(name);
+}
+
+// Returns the names packed into the atlas; empty when the manifest is missing or malformed.
+inline std::unordered_set<std::string> register_sprite_atlas() {
+  std::unordered_set<std::string> packed{};
+  std::ifstream in(file::asset(std::string("shrooms/") + kSpriteAtlasName + ".atlas"));
+  if (!in.is_open()) {
+    std::cerr << "Sprite atlas manifest missing, using standalone textures" << std::endl;
+    return packed;
+  }
+  std::string key;
+  float atlas_w = 0.0f;
+  float atlas_h = 0.0f;
+  if (!(in >> key >> atlas_w >> atlas_h) || key != "size" || atlas_w <= 0.0f ||
+      atlas_h <= 0.0f) {
+    std::cerr << "Sprite atlas manifest is malformed" << std::endl;
+    return packed;
+  }
+
+  register_svg_or_cached(kSpriteAtlasName, width_ratio_from_reference(atlas_w));
+  const engine::TextureId atlas = engine::resources::register_texture(kSpriteAtlasName);
+
+  std::string name;
+  float x = 0.0f;
+  float y = 0.0f;
+  float w = 0.0f;
+  float h = 0.0f;
+  while (in >> name >> x >> y >> w >> h) {
+    const sprite_batch::UvRect uv{x / atlas_w, y / atlas_h, (x + w) / atlas_w, (y + h) / atlas_h};
+    sprite_batch::atlas_regions[engine::resources::register_texture(name)] =
+        sprite_batch::AtlasRegion{atlas, uv};
+    packed.insert(name);
+  }
+  return packed;
+}
+
 inline void register_shrooms_svg_assets() {
-  auto register_svg = [](const char* name) {
-    const glm::vec2 size = shrooms::texture_sizing::reference_size(name);
-    const float width_ratio = width_ratio_from_reference(size.x);
-    engine::resources::register_svg_texture(name, width_ratio);
-  };
+  auto register_svg = [](const char* name) { register_svg_at_reference_width(name); };
   auto register_svg_with_min_reference_width = [](const char* name,
                                                   float min_reference_width_px) {
     const glm::vec2 size = shrooms::texture_sizing::reference_size(name);
@@ -36,15 +111,13 @@ inline void register_shrooms_svg_assets() {
       reference_width = min_reference_width_px;
     }
     const float width_ratio = width_ratio_from_reference(reference_width);
-    engine::resources::register_svg_texture(name, width_ratio);
+    register_svg_or_cached(name, width_ratio);
   };
 
-  register_svg("mukhomor");
-  register_svg("lisi4ka");
-  register_svg("borovik");
-  register_svg("mukhomor_small");
-  register_svg("lisi4ka_small");
-  register_svg("borovik_small");
+  const std::unordered_set<std::string> packed = register_sprite_atlas();
+  for (const char* name : kSpriteAtlasMembers) {
+    if (!packed.contains(name)) register_svg(name);
+  }
 
   register_svg("witch_left_1");
   register_svg("witch_left_2");
@@ -63,28 +136,10 @@ inline void register_shrooms_svg_assets() {
   register_svg("menu_pause");
   register_svg("menu_face");
   register_svg("menu_scoreboard");
-  register_svg("heart");
-  register_svg("background");
+  // The menu and pause window show this one immediately; level_* load via acquire_background.
+  prefetch_background(kMenuBackgroundName);
   register_svg("bottom_1");
   register_svg("bottom_2");
-
-  register_svg("level_1_ezh");
-  register_svg("level_2_eli");
-  register_svg("level_3_izba");
-  register_svg("level_4_lyaguha");
-  register_svg("level_5_mol");
-  register_svg("level_6_tzar");
-  register_svg("level_7_yagoda");
-
-  register_svg("emoji_hedgehog");
-  register_svg("emoji_tree");
-  register_svg("emoji_house");
-  register_svg("emoji_frog");
-  register_svg("emoji_fly");
-  register_svg("emoji_crown");
-  register_svg("emoji_strawberry");
-  register_svg("emoji_infinity");
-  register_svg("emoji_lock");
 }
 
 }  // namespace shrooms
@@ -12,6 +12,7 @@
 #include "glm/glm/vec2.hpp"
 
 #include "shrooms_screen.hpp"
+#include "shrooms_svg_manifest.hpp"
 #include "utils/file_system.hpp"
 
 namespace shrooms::texture_sizing {
@@ -22,6 +23,17 @@ inline constexpr float width_scale_from_reference(float reference_width_px) {
   return reference_width_px > 0.0f ? (reference_width_px / kReferenceCanvasWidthPx) : 0.0f;
 }
 
+// Build-time metadata for every shipped SVG; nullptr for PNG-only textures and for SVGs added
+// since the manifest was last regenerated (shrooms_svg_manifest target).
+inline const svg_manifest::Entry* manifest_entry(std::string_view texture_name) {
+  const auto& entries = svg_manifest::kEntries;
+  const auto it = std::lower_bound(
+      entries.begin(), entries.end(), texture_name,
+      [](const svg_manifest::Entry& entry, std::string_view name) { return entry.name < name; });
+  if (it == entries.end() || it->name != texture_name) return nullptr;
+  return &*it;
+}
+
 inline std::optional<glm::vec2> parse_viewbox_size(const std::string& svg_text) {
   const size_t key_pos = svg_text.find("viewBox");
   if (key_pos == std::string::npos) return std::nullopt;
@@ -73,6 +85,11 @@ inline glm::vec2 reference_size(std::string_view texture_name) {
     return glm::vec2{0.0f, 0.0f};
   }
 
+  if (const auto* entry = manifest_entry(key)) {
+    const glm::vec2 size{entry->width, entry->height};
+    cached_sizes.emplace(key, size);
+    return size;
+  }
   if (auto loaded = load_svg_reference_size(key)) {
     cached_sizes.emplace(key, *loaded);
     return *loaded;
@@ -82,55 +99,15 @@ inline glm::vec2 reference_size(std::string_view texture_name) {
   return glm::vec2{0.0f, 0.0f};
 }
 
+// Textures without SVG metadata (bullet, fire, digits_N, ...) are square PNGs.
 inline float aspect_ratio(std::string_view texture_name) {
+  if (const auto* entry = manifest_entry(texture_name)) {
+    return entry->aspect;
+  }
   const glm::vec2 measured = reference_size(texture_name);
   if (measured.x > 0.0f && measured.y > 0.0f) {
     return measured.x / measured.y;
   }
-
-  if (texture_name == "famiriar") return 29.0f / 14.0f;
-
-  if (texture_name == "witch") return 35.0f / 39.0f;
-  if (texture_name == "witch_left_1" || texture_name == "witch_left_2" ||
-      texture_name == "witch_right_1" || texture_name == "witch_right_2") {
-    return 38.0f / 39.0f;
-  }
-  if (texture_name == "witch_fly_left_1" || texture_name == "witch_fly_left_2" ||
-      texture_name == "witch_fly_right_1" || texture_name == "witch_fly_right_2") {
-    return 62.0f / 41.0f;
-  }
-
-  if (texture_name == "mukhomor") return 28.0f / 26.0f;
-  if (texture_name == "lisi4ka") return 25.0f / 24.0f;
-  if (texture_name == "borovik") return 27.0f / 26.0f;
-  if (texture_name == "mukhomor_small") return 16.0f / 15.0f;
-  if (texture_name == "lisi4ka_small") return 15.0f / 14.0f;
-  if (texture_name == "borovik_small") return 16.0f / 16.0f;
-
-  if (texture_name == "menu_face") return 67.0f / 63.0f;
-  if (texture_name == "menu_scoreboard") return 64.0f / 88.0f;
-  if (texture_name == "face_mini_1" || texture_name == "face_mini_2") {
-    return 44.0f / 24.0f;
-  }
-
-  if (texture_name == "level_1_ezh") return 298.0f / 255.0f;
-  if (texture_name == "level_2_eli") return 298.0f / 290.0f;
-  if (texture_name == "level_3_izba") return 298.0f / 266.0f;
-  if (texture_name == "level_4_lyaguha") return 298.0f / 287.0f;
-  if (texture_name == "level_5_mol") return 312.0f / 263.0f;
-  if (texture_name == "level_6_tzar") return 298.0f / 277.0f;
-  if (texture_name == "level_7_yagoda") return 298.0f / 281.0f;
-
-  if (texture_name == "bottom_1") return 298.0f / 20.0f;
-  if (texture_name == "bottom_2") return 298.0f / 23.0f;
-
-  if (texture_name == "bullet") return 1.0f;
-  if (texture_name == "pause_menu" || texture_name == "menu_pause") return 1.0f;
-  if (texture_name == "fire") return 1.0f;
-  if (texture_name == "explosion") return 1.0f;
-  if (texture_name == "slash") return 1.0f;
-  if (texture_name.size() == 8 && texture_name.substr(0, 7) == "digits_") return 1.0f;
-
   return 1.0f;
 }
 
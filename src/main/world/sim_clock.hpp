@@ -0,0 +1,111 @@
+#pragma once
+
+#include <algorithm>
+
+#include "glm/glm/vec2.hpp"
+
+#include "ecs/ecs.hpp"
+#include "ecs/context.hpp"
+#include "utils/arena.hpp"
+#include "systems/dynamic/dynamic_object.hpp"
+#include "systems/scene/scene_system.hpp"
+#include "systems/transformation/transform_object.hpp"
+
+// Fixed-timestep clock for gameplay motion. Per-tick speeds (PlayerController::step_px,
+// `moving` components in mushrooms.data) are tuned for 60 ticks per second regardless of the
+// display refresh rate; rendered positions are interpolated between the last two ticks.
+namespace sim_clock {
+
+inline constexpr double kStepSeconds = 1.0 / 60.0;
+// Caps catch-up after a stall (tab throttling, breakpoints) so the sim never spirals.
+inline constexpr int kMaxStepsPerFrame = 5;
+
+inline double accumulator = 0.0;
+inline double synced_time = -1.0;
+inline int steps = 0;
+inline float alpha = 0.0f;
+
+// Advances the accumulator once per rendered frame. Every fixed-step consumer calls this
+// before reading `steps`/`alpha`; later calls within the same frame are no-ops.
+inline void sync() {
+  const auto& ctx = ecs::context();
+  if (ctx.time_seconds == synced_time) return;
+  synced_time = ctx.time_seconds;
+
+  accumulator += std::max(0.0, static_cast<double>(ctx.delta_seconds));
+  steps = 0;
+  while (accumulator >= kStepSeconds && steps < kMaxStepsPerFrame) {
+    accumulator -= kStepSeconds;
+    ++steps;
+  }
+  if (steps == kMaxStepsPerFrame) {
+    accumulator = std::min(accumulator, kStepSeconds);
+  }
+  alpha = static_cast<float>(accumulator / kStepSeconds);
+}
+
+inline void reset() {
+  accumulator = 0.0;
+  synced_time = -1.0;
+  steps = 0;
+  alpha = 0.0f;
+}
+
+// Previous/current tick samples of a position plus the last interpolated value written back.
+// Writes made by other systems between frames (wobble, carry, teleports) are folded into both
+// samples so they are preserved instead of being overwritten by the interpolation.
+struct InterpolatedPosition {
+  void absorb(const glm::vec2& pos) {
+    if (!valid) {
+      previous = pos;
+      current = pos;
+      rendered = pos;
+      valid = true;
+      return;
+    }
+    const glm::vec2 external = pos - rendered;
+    previous += external;
+    current += external;
+  }
+
+  void step(const glm::vec2& delta) {
+    previous = current;
+    current += delta;
+  }
+
+  glm::vec2 present() {
+    rendered = previous + (current - previous) * alpha;
+    return rendered;
+  }
+
+  glm::vec2 previous{0.0f, 0.0f};
+  glm::vec2 current{0.0f, 0.0f};
+  glm::vec2 rendered{0.0f, 0.0f};
+  bool valid = false;
+};
+
+// Fixed-step replacement for dynamic::MovingObject: `translate` is applied once per sim tick.
+struct FixedStepMover : public dynamic::DynamicObject {
+  explicit FixedStepMover(glm::vec2 translate)
+      : dynamic::DynamicObject(), translate(translate) {}
+  ~FixedStepMover() override { Component::component_count--; }
+
+  void update() override {
+    if (scene::is_current_scene_paused()) return;
+    if (!entity || entity->is_pending_deletion()) return;
+    auto* transform = entity->get<transform::NoRotationTransform>();
+    if (!transform) return;
+
+    sync();
+    position.absorb(transform->pos);
+    for (int i = 0; i < steps; ++i) {
+      position.step(translate);
+    }
+    transform->pos = position.present();
+  }
+
+  glm::vec2 translate{0.0f, 0.0f};
+  InterpolatedPosition position{};
+};
+
+}  // namespace sim_clock
@@ -0,0 +1,81 @@
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include <unordered_set>
+
+#include "ecs/ecs.hpp"
+#include "systems/dynamic/dynamic_object.hpp"
+#include "systems/scene/scene_system.hpp"
+#include "systems/spawn/periodic_spawner_object.hpp"
+
+namespace levels {
+void govern_spawners();
+}  // namespace levels
+
+// Bounds how much is alive at once so worst-case frame cost stays flat on weak devices. The
+// live-mushroom caps change difficulty, so they default to unlimited, are opt-in through
+// config.toml and are recorded in replays. A spawner whose type (or the whole field) is at its
+// live-mushroom cap is held: its timer stops until catches, misses or sorts free a slot, so
+// spawns are deferred rather than dropped and every spawner still fires its seeded sequence in
+// order. Particles past max_particles are skipped by the VFX emitters; that budget is cosmetic
+// and never gates gameplay.
+namespace spawn_governor {
+
+struct Config {
+  float max_live_per_type = 0.0f;
+  float max_live_total = 0.0f;
+  float max_particles = 1200.0f;
+};
+
+inline Config config{};
+inline std::unordered_set<periodic_spawn::PeriodicSpawnerObject*> held{};
+inline uint64_t hold_count = 0;
+
+// Caps at or below zero are unlimited.
+inline bool under_cap(size_t live, float cap) {
+  return cap <= 0.0f || static_cast<float>(live) < cap;
+}
+
+inline bool caps_enabled() {
+  return config.max_live_per_type > 0.0f || config.max_live_total > 0.0f;
+}
+
+inline bool admits(size_t live_of_type, size_t live_total) {
+  return under_cap(live_of_type, config.max_live_per_type) &&
+         under_cap(live_total, config.max_live_total);
+}
+
+inline bool is_held(periodic_spawn::PeriodicSpawnerObject* spawner) {
+  return held.contains(spawner);
+}
+
+inline void hold(periodic_spawn::PeriodicSpawnerObject* spawner) {
+  spawner->enabled = false;
+  held.insert(spawner);
+  ++hold_count;
+}
+
+inline void release(periodic_spawn::PeriodicSpawnerObject* spawner) {
+  spawner->enabled = true;
+  held.erase(spawner);
+}
+
+// Level logic disabled every spawner; held ones must stay off.
+inline void forget() { held.clear(); }
+
+// The spawner was re-enabled or replaced behind the governor's back; it is no longer held.
+inline void forget(periodic_spawn::PeriodicSpawnerObject* spawner) { held.erase(spawner); }
+
+// Runs before the periodic spawner system so a held spawner never fires that tick.
+struct GovernorSystem : public dynamic::DynamicObject {
+  GovernorSystem() : dynamic::DynamicObject() {}
+  ~GovernorSystem() override { Component::component_count--; }
+
+  void update() override {
+    if (scene::is_current_scene_paused()) return;
+    levels::govern_spawners();
+  }
+};
+
+}  // namespace spawn_governor
@@ -0,0 +1,130 @@
+#pragma once
+
+#include <array>
+#include <map>
+#include <string>
+#include <unordered_map>
+
+#include "glm/glm/vec2.hpp"
+#include "glm/glm/vec4.hpp"
+
+#include "ecs/ecs.hpp"
+#include "systems/color/color_system.hpp"
+#include "systems/render/render_system.hpp"
+#include "systems/render/sprite_system.hpp"
+#include "systems/transformation/transform_object.hpp"
+#include "engine/geometry_builder.h"
+#include "engine/math.h"
+#include "engine/resource_ids.h"
+
+// Shared-geometry sprite path. Every sprite drawn through here uses one unit quad per UV rect
+// and carries its transform, size and tint in the draw item, so sprites that share a texture,
+// layer and shader differ only in per-instance data and the backend can merge them into one
+// instanced draw. Resizing a batched sprite never rebuilds or re-uploads geometry.
+namespace sprite_batch {
+
+struct SharedGeometry {
+  engine::GeometryId id = engine::kInvalidGeometryId;
+  engine::GeometryData data{};
+  bool uploaded = false;
+};
+
+using UvRect = std::array<float, 4>;  // u0, v0, u1, v1
+inline constexpr UvRect kFullUv{0.0f, 0.0f, 1.0f, 1.0f};
+
+inline std::map<UvRect, SharedGeometry> unit_quads{};
+
+inline SharedGeometry& unit_quad(const UvRect& uv = kFullUv) {
+  auto& geometry = unit_quads[uv];
+  if (geometry.id == engine::kInvalidGeometryId) {
+    geometry.id = engine::resources::register_geometry(
+        "shrooms_unit_quad_" + std::to_string(unit_quads.size()));
+    if (uv == kFullUv) {
+      geometry.data = engine::geometry::make_quad(1.0f, 1.0f);
+    } else {
+      geometry.data = engine::geometry::make_quad(
+          1.0f, 1.0f, {uv[0], uv[1], uv[2], uv[1], uv[0], uv[3], uv[2], uv[3]});
+    }
+  }
+  return geometry;
+}
+
+// Textures packed into a sprite atlas resolve to the atlas texture and their cell's UV rect.
+struct AtlasRegion {
+  engine::TextureId atlas = engine::kInvalidTextureId;
+  UvRect uv = kFullUv;
+};
+
+inline std::unordered_map<engine::TextureId, AtlasRegion> atlas_regions{};
+
+inline UvRect sub_rect(const UvRect& outer, const UvRect& inner) {
+  const float du = outer[2] - outer[0];
+  const float dv = outer[3] - outer[1];
+  return UvRect{
+      outer[0] + inner[0] * du,
+      outer[1] + inner[1] * dv,
+      outer[0] + inner[2] * du,
+      outer[1] + inner[3] * dv,
+  };
+}
+
+// Maps a texture and a UV rect within it to the texture that actually holds the pixels.
+inline engine::TextureId resolve(engine::TextureId texture_id, UvRect& uv) {
+  const auto it = atlas_regions.find(texture_id);
+  if (it == atlas_regions.end()) return texture_id;
+  uv = sub_rect(it->second.uv, uv);
+  return it->second.atlas;
+}
+
+inline void upload(SharedGeometry& geometry, engine::RenderPass& pass) {
+  if (geometry.uploaded || geometry.id == engine::kInvalidGeometryId) return;
+  pass.uploads.push_back(engine::GeometryUpload{geometry.id, geometry.data});
+  geometry.uploaded = true;
+}
+
+// Uploads every shared quad that has not reached the GPU yet.
+inline void upload_pending(engine::RenderPass& pass) {
+  for (auto& [uv, geometry] : unit_quads) {
+    upload(geometry, pass);
+  }
+}
+
+inline engine::Mat4 instance_model(const glm::vec2& top_left, const glm::vec2& size) {
+  return engine::mat4_mul(
+      engine::mat4_translate(top_left.x + render_system::view_offset_x,
+                             top_left.y + render_system::view_offset_y, 0.0f),
+      engine::mat4_scale(size.x, size.y, 1.0f));
+}
+
+struct BatchedSprite : public render_system::SpriteRenderable {
+  BatchedSprite(engine::TextureId texture_id, glm::vec2 size, const UvRect& uv = kFullUv)
+      : render_system::SpriteRenderable(texture_id, size), uv(uv) {}
+
+  void emit(engine::RenderPass& pass) override {
+    if (!entity || entity->is_pending_deletion()) return;
+    auto* transform = entity->get<transform::TransformObject>();
+    if (!transform) return;
+
+    UvRect resolved_uv = uv;
+    const engine::TextureId resolved_texture = resolve(texture_id, resolved_uv);
+    auto& quad = unit_quad(resolved_uv);
+    upload(quad, pass);
+
+    engine::UIColor color = tint;
+    if (auto* colored = entity->get<color::ColoredObject>()) {
+      const auto c = colored->get_color();
+      color = engine::UIColor{c.x, c.y, c.z, c.w};
+    }
+
+    engine::DrawItem item{};
+    item.geometry_id = quad.id;
+    item.model = instance_model(transform->get_pos(), size);
+    item.color = color;
+    item.texture_id = resolved_texture;
+    pass.draw_items.push_back(std::move(item));
+  }
+
+  UvRect uv = kFullUv;
+};
+
+}  // namespace sprite_batch
@@ -0,0 +1,84 @@
+#pragma once
+
+#include <cmath>
+#include <cstdint>
+#include <fstream>
+#include <sstream>
+#include <string>
+#include <string_view>
+#include <unordered_map>
+
+#include "engine/resource_ids.h"
+#include "utils/file_system.hpp"
+
+#include "shrooms_screen.hpp"
+#include "shrooms_texture_sizing.hpp"
+
+// Pre-rasterized SVGs baked by the shrooms_raster_cache target (src/tools/svg_raster_cache.cpp)
+// into the build tree and packaged over assets/shrooms.
+// A baked PNG is used only while its SVG's content hash and target width still match the index,
+// so editing an SVG without re-baking falls back to runtime rasterization instead of showing
+// stale art.
+namespace shrooms::raster_cache {
+
+inline constexpr const char* kIndexPath = "shrooms/raster.index";
+
+struct Entry {
+  uint32_t hash = 0;
+  int width_px = 0;
+};
+
+// Must match content_hash() in src/tools/svg_raster_cache.cpp.
+inline uint32_t content_hash(std::string_view text) {
+  uint32_t hash = 2166136261u;
+  for (char c : text) {
+    hash ^= static_cast<uint8_t>(c);
+    hash *= 16777619u;
+  }
+  return hash;
+}
+
+inline int target_width_px(float width_ratio) {
+  return static_cast<int>(
+      std::lround(width_ratio * static_cast<float>(shrooms::screen::view_width)));
+}
+
+inline const std::unordered_map<std::string, Entry>& index() {
+  static const std::unordered_map<std::string, Entry> entries = [] {
+    std::unordered_map<std::string, Entry> loaded{};
+    std::ifstream in(file::asset(kIndexPath));
+    if (!in.is_open()) return loaded;
+    std::string name;
+    Entry entry{};
+    while (in >> name >> entry.hash >> entry.width_px) {
+      loaded[name] = entry;
+    }
+    return loaded;
+  }();
+  return entries;
+}
+
+// Registers the baked PNG for `name` when it is current. Returns false when the caller has to
+// rasterize the SVG itself.
+inline bool try_register(const std::string& name, float width_ratio) {
+  const auto& entries = index();
+  const auto it = entries.find(name);
+  if (it == entries.end()) return false;
+  if (it->second.width_px != target_width_px(width_ratio)) return false;
+
+  // The SVG manifest already carries the content hash; only SVGs missing from it are re-read.
+  if (const auto* entry = texture_sizing::manifest_entry(name)) {
+    if (entry->hash != it->second.hash) return false;
+  } else {
+    std::ifstream svg(file::asset("shrooms/" + name + ".svg"), std::ios::binary);
+    if (!svg.is_open()) return false;
+    std::stringstream buffer;
+    buffer << svg.rdbuf();
+    if (content_hash(buffer.str()) != it->second.hash) return false;
+  }
+
+  engine::resources::register_texture(name);
+  return true;
+}
+
+}  // namespace shrooms::raster_cache
@@ -0,0 +1,314 @@
+#pragma once
+
+#include <algorithm>
+#include <array>
+#include <chrono>
+#include <cstddef>
+#include <cstdlib>
+#include <fstream>
+#include <iostream>
+#include <sstream>
+#include <string>
+#include <unordered_map>
+#include <vector>
+
+#include "glm/glm/vec2.hpp"
+#include "glm/glm/vec4.hpp"
+
+#include "ecs/ecs.hpp"
+#include "utils/arena.hpp"
+#include "systems/color/color_system.hpp"
+#include "systems/hidden/hidden_object.hpp"
+#include "systems/layer/layered_object.hpp"
+#include "systems/render/render_system.hpp"
+#include "systems/scene/scene_object.hpp"
+#include "systems/scene/scene_system.hpp"
+#include "systems/text/text_object.hpp"
+#include "systems/transformation/transform_object.hpp"
+#include "adaptive_quality.hpp"
+#include "broadphase.hpp"
+#include "entity_handles.hpp"
+#include "vfx.hpp"
+
+// Per-frame counters for telling VFX churn, collision load and render cost apart: live
+// components, mushroom bodies and sensors, particles by kind, draw items per pass, render-target
+// memory and wall-clock frame time percentiles. Debug builds show them as a text overlay over
+// whichever scene is active, toggled from the params UI; native builds also append one CSV row
+// per interval when SHROOMS_TELEMETRY_CSV names an output file.
+namespace telemetry {
+
+struct Config {
+  float overlay = 0.0f;  // 0 = hidden, 1 = shown; a float so the params UI can toggle it
+  float font_px = 14.0f;
+  float line_spacing_px = 18.0f;
+  glm::vec2 origin_px{12.0f, 12.0f};
+  glm::vec4 color{0.95f, 1.0f, 0.85f, 0.9f};
+  float refresh_seconds = 0.25f;
+  float csv_interval_seconds = 1.0f;
+  int layer = 190;
+};
+
+inline Config config{};
+
+inline constexpr size_t kFrameHistory = 240;
+
+struct PassStats {
+  std::string name;
+  size_t draw_items = 0;
+};
+
+struct Snapshot {
+  long long components = 0;
+  size_t handle_slots = 0;
+  size_t bodies = 0;
+  size_t sensors = 0;
+  size_t spores = 0;
+  size_t bubbles = 0;
+  size_t bursts = 0;
+  size_t shatter = 0;
+  size_t score_popups = 0;
+  size_t draw_items = 0;
+  size_t target_bytes = 0;
+  float frame_ms_p50 = 0.0f;
+  float frame_ms_p95 = 0.0f;
+  float frame_ms_p99 = 0.0f;
+  std::vector<PassStats> passes{};
+};
+
+inline Snapshot current{};
+
+inline std::array<float, kFrameHistory> frame_ms{};
+inline size_t frame_ms_count = 0;
+inline size_t frame_ms_next = 0;
+inline std::chrono::steady_clock::time_point last_frame{};
+inline bool has_last_frame = false;
+
+inline void record_frame_time() {
+  const auto now = std::chrono::steady_clock::now();
+  if (has_last_frame) {
+    frame_ms[frame_ms_next] =
+        std::chrono::duration<float, std::milli>(now - last_frame).count();
+    frame_ms_next = (frame_ms_next + 1) % kFrameHistory;
+    frame_ms_count = std::min(frame_ms_count + 1, kFrameHistory);
+  }
+  last_frame = now;
+  has_last_frame = true;
+}
+
+inline float last_frame_ms() {
+  return frame_ms_count > 0 ? frame_ms[(frame_ms_next + kFrameHistory - 1) % kFrameHistory]
+                            : 0.0f;
+}
+
+inline void compute_percentiles(Snapshot& snapshot) {
+  if (frame_ms_count == 0) return;
+  std::array<float, kFrameHistory> sorted{};
+  std::copy_n(frame_ms.begin(), frame_ms_count, sorted.begin());
+  std::sort(sorted.begin(), sorted.begin() + static_cast<std::ptrdiff_t>(frame_ms_count));
+  const auto at = [&](float q) {
+    const size_t index = static_cast<size_t>(q * static_cast<float>(frame_ms_count - 1) + 0.5f);
+    return sorted[std::min(index, frame_ms_count - 1)];
+  };
+  snapshot.frame_ms_p50 = at(0.50f);
+  snapshot.frame_ms_p95 = at(0.95f);
+  snapshot.frame_ms_p99 = at(0.99f);
+}
+
+inline size_t bytes_per_pixel(engine::RenderTargetFormat format) {
+  switch (format) {
+    case engine::RenderTargetFormat::R8:
+      return 1;
+    case engine::RenderTargetFormat::RGBA8:
+    default:
+      return 4;
+  }
+}
+
+inline void sample(const engine::Frame& frame) {
+  Snapshot snapshot{};
+  snapshot.components = static_cast<long long>(ecs::Component::component_count);
+  snapshot.handle_slots = entity_handles::live_slots();
+  snapshot.bodies = broadphase::bodies.size();
+  snapshot.sensors = broadphase::sensors.size();
+  snapshot.spores = vfx::spore_pool.count;
+  snapshot.bubbles = vfx::bubble_pool.count;
+  snapshot.bursts = vfx::burst_pool.count;
+  snapshot.shatter = vfx::shatter_pool.count;
+  snapshot.score_popups = vfx::score_deltas_active();
+
+  snapshot.passes.reserve(frame.plan.passes.size());
+  for (const auto& pass : frame.plan.passes) {
+    snapshot.passes.push_back(PassStats{pass.name, pass.draw_items.size()});
+    snapshot.draw_items += pass.draw_items.size();
+  }
+  for (const auto& target : frame.plan.targets) {
+    snapshot.target_bytes += static_cast<size_t>(target.width) *
+                             static_cast<size_t>(target.height) * bytes_per_pixel(target.format);
+  }
+  compute_percentiles(snapshot);
+  current = std::move(snapshot);
+}
+
+// --- Overlay ---------------------------------------------------------------------------------
+
+inline constexpr size_t kOverlayLines = 6;
+
+// Plain text entities on a layer above the HUD and the glow tint; nothing shakes them. One set
+// is built per scene the overlay has been shown in, and only the active scene's set is visible.
+struct OverlaySet {
+  std::array<text::TextObject*, kOverlayLines> text{};
+  std::array<hidden::HiddenObject*, kOverlayLines> hidden{};
+};
+
+inline std::unordered_map<std::string, OverlaySet> overlays{};
+inline std::array<std::string, kOverlayLines> overlay_text{};
+inline float refresh_elapsed = 0.0f;
+
+inline OverlaySet& overlay_for(const std::string& scene_name) {
+  auto [it, inserted] = overlays.try_emplace(scene_name);
+  if (!inserted) return it->second;
+  auto& set = it->second;
+  for (size_t i = 0; i < kOverlayLines; ++i) {
+    auto* entity = arena::create<ecs::Entity>();
+    auto* transform = arena::create<transform::NoRotationTransform>();
+    transform->pos =
+        config.origin_px + glm::vec2{0.0f, config.line_spacing_px * static_cast<float>(i)};
+    entity->add(transform);
+    entity->add(arena::create<layers::ConstLayer>(config.layer));
+    set.text[i] = arena::create<text::TextObject>("", config.font_px);
+    entity->add(set.text[i]);
+    entity->add(arena::create<color::OneColor>(config.color));
+    set.hidden[i] = arena::create<hidden::HiddenObject>();
+    set.hidden[i]->hide();
+    entity->add(set.hidden[i]);
+    entity->add(arena::create<scene::SceneObject>(scene_name));
+  }
+  return set;
+}
+
+inline void set_visible(OverlaySet& set, bool visible) {
+  for (auto* hidden : set.hidden) {
+    if (!hidden) continue;
+    if (visible) {
+      hidden->show();
+    } else {
+      hidden->hide();
+    }
+  }
+}
+
+inline std::string format_ms(float value) {
+  std::ostringstream out;
+  out.setf(std::ios::fixed);
+  out.precision(1);
+  out << value;
+  return out.str();
+}
+
+inline void refresh_overlay() {
+  const auto& s = current;
+  std::ostringstream passes;
+  size_t shown = 0;
+  for (const auto& pass : s.passes) {
+    if (pass.draw_items == 0) continue;
+    if (shown++ > 0) passes << ' ';
+    passes << pass.name << '=' << pass.draw_items;
+  }
+  const std::array<std::string, kOverlayLines> lines{
+      "frame ms p50 " + format_ms(s.frame_ms_p50) + "  p95 " + format_ms(s.frame_ms_p95) +
+          "  p99 " + format_ms(s.frame_ms_p99),
+      "components " + std::to_string(s.components) + "  handles " +
+          std::to_string(s.handle_slots),
+      "bodies " + std::to_string(s.bodies) + "  sensors " + std::to_string(s.sensors),
+      "spores " + std::to_string(s.spores) + "  bubbles " + std::to_string(s.bubbles) +
+          "  bursts " + std::to_string(s.bursts) + "  shatter " + std::to_string(s.shatter) +
+          "  popups " + std::to_string(s.score_popups),
+      "draw items " + std::to_string(s.draw_items) + "  " + passes.str(),
+      "targets " + std::to_string(s.target_bytes / 1024) + " KiB  quality tier " +
+          std::to_string(adaptive_quality::current_tier()) + "  budget " +
+          format_ms(adaptive_quality::budget_ms()) + " ms",
+  };
+  overlay_text = lines;
+}
+
+// Debug builds only: called from the debug UI block in after_tick, next to the params UI.
+inline void update_overlay() {
+  auto* active = scene::get_active_scene();
+  const bool shown = config.overlay >= 0.5f && active;
+  const std::string active_name = shown ? std::string(active->get_name()) : std::string();
+  if (shown) {
+    auto& set = overlay_for(active_name);
+    for (size_t i = 0; i < kOverlayLines; ++i) set.text[i]->text = overlay_text[i];
+  }
+  for (auto& [name, set] : overlays) set_visible(set, shown && name == active_name);
+}
+
+// --- CSV -------------------------------------------------------------------------------------
+
+#ifndef __EMSCRIPTEN__
+inline std::ofstream csv{};
+inline bool csv_checked = false;
+inline float csv_elapsed = 0.0f;
+inline double csv_clock = 0.0;
+
+inline void open_csv() {
+  csv_checked = true;
+  const char* path = std::getenv("SHROOMS_TELEMETRY_CSV");
+  if (!path || !*path) return;
+  csv.open(path, std::ios::out | std::ios::trunc);
+  if (!csv) {
+    std::cerr << "telemetry: failed to open " << path << "\n";
+    return;
+  }
+  csv << "time_s,frame_ms_p50,frame_ms_p95,frame_ms_p99,components,handle_slots,bodies,"
+         "sensors,spores,bubbles,bursts,shatter,score_popups,draw_items,target_bytes\n";
+}
+
+inline void write_csv_row() {
+  const auto& s = current;
+  csv << csv_clock << ',' << s.frame_ms_p50 << ',' << s.frame_ms_p95 << ',' << s.frame_ms_p99
+      << ',' << s.components << ',' << s.handle_slots << ',' << s.bodies << ',' << s.sensors
+      << ',' << s.spores << ',' << s.bubbles << ',' << s.bursts << ',' << s.shatter << ','
+      << s.score_popups << ',' << s.draw_items << ',' << s.target_bytes << '\n';
+  csv.flush();
+}
+#endif
+
+// Called once per rendered frame after the frame plan is complete.
+inline void on_frame(const engine::Frame& frame) {
+  record_frame_time();
+  const float dt = last_frame_ms() * 0.001f;
+
+#ifndef NDEBUG
+  bool wants_sample = config.overlay >= 0.5f;
+#else
+  bool wants_sample = false;
+#endif
+#ifndef __EMSCRIPTEN__
+  if (!csv_checked) open_csv();
+  wants_sample = wants_sample || csv.is_open();
+#endif
+  if (!wants_sample) return;
+  sample(frame);
+
+  if (config.overlay >= 0.5f) {
+    refresh_elapsed += dt;
+    if (refresh_elapsed >= config.refresh_seconds) {
+      refresh_elapsed = 0.0f;
+      refresh_overlay();
+    }
+  }
+
+#ifndef __EMSCRIPTEN__
+  if (csv.is_open()) {
+    csv_clock += dt;
+    csv_elapsed += dt;
+    if (csv_elapsed >= config.csv_interval_seconds) {
+      csv_elapsed = 0.0f;
+      write_csv_row();
+    }
+  }
+#endif
+}
+
+}  // namespace telemetry
@@ -27,7 +27,9 @@
 #include "systems/text/text_object.hpp"
 #include "systems/transformation/transform_object.hpp"
 
+#include "entity_handles.hpp"
 #include "level_manager.hpp"
+#include "mushroom_pool.hpp"
 #include "controls.hpp"
 #include "countdown.hpp"
 #include "player.hpp"
@@ -35,6 +37,7 @@
 #include "scoreboard.hpp"
 #include "shrooms_screen.hpp"
 #include "shrooms_texture_sizing.hpp"
+#include "sprite_batch.hpp"
 #include "touchscreen.hpp"
 
 namespace tutorial {
@@ -90,9 +93,9 @@ inline std::array<glm::vec2, kTrapTargetCount> trap_familiar_centers_px{};
 inline std::array<bool, kTrapTargetCount> trap_target_filled{};
 inline int trap_target_filled_count = 0;
 
-inline ecs::Entity* stage_entity_a = nullptr;
-inline ecs::Entity* stage_entity_b = nullptr;
-inline ecs::Entity* stage_entity_c = nullptr;
+inline entity_handles::Handle stage_entity_a{};
+inline entity_handles::Handle stage_entity_b{};
+inline entity_handles::Handle stage_entity_c{};
 inline bool stage_a_done = false;
 inline bool stage_b_done = false;
 inline bool stage_c_done = false;
@@ -327,12 +330,13 @@ inline void show_trap_markers() {
 }
 
 inline void clear_stage_entities(bool delete_entities = true) {
-  auto clear_one = [&](ecs::Entity*& entity) {
-    if (!entity) return;
-    if (delete_entities && !entity->is_pending_deletion()) {
-      entity->mark_deleted();
+  auto clear_one = [&](entity_handles::Handle& handle) {
+    if (delete_entities) {
+      if (auto* entity = handle.get()) {
+        mushroom_pool::release(entity);
+      }
     }
-    entity = nullptr;
+    handle = nullptr;
   };
   clear_one(stage_entity_a);
   clear_one(stage_entity_b);
@@ -628,7 +632,7 @@ inline ecs::Entity* spawn_recipe_preview(const std::string& type, const glm::vec
   entity->add(transform);
   entity->add(arena::create<layers::ConstLayer>(8));
   const engine::TextureId tex_id = engine::resources::register_texture(type);
-  entity->add(arena::create<render_system::SpriteRenderable>(tex_id, size));
+  entity->add(arena::create<sprite_batch::BatchedSprite>(tex_id, size));
   entity->add(arena::create<color::OneColor>(glm::vec4{1.0f, 1.0f, 1.0f, 0.45f}));
   entity->add(arena::create<PreviewBlink>());
   entity->add(arena::create<scene::SceneObject>("main"));
@@ -845,9 +849,8 @@ inline void stop() {
 
 inline bool is_active() { return active; }
 
-inline bool is_stage_entity(ecs::Entity* entity, ecs::Entity* tracked) {
-  if (!entity || !tracked) return false;
-  return entity == tracked;
+inline bool is_stage_entity(ecs::Entity* entity, const entity_handles::Handle& tracked) {
+  return tracked.is(entity);
 }
 
 inline void on_mushroom_spawned(const std::string&, ecs::Entity*) {}
@@ -1079,8 +1082,8 @@ struct TutorialController : public dynamic::DynamicObject {
       return;
     }
     if (stage == Stage::ShootPractice) {
-      if (stage_entity_a && !stage_entity_a->is_pending_deletion()) {
-        show_marker(entity_center(stage_entity_a),
+      if (auto* target = stage_entity_a.get()) {
+        show_marker(entity_center(target),
                     engine::UIColor{0.95f, 0.35f, 0.35f, 0.9f});
       }
       return;
@@ -1092,8 +1095,9 @@ struct TutorialController : public dynamic::DynamicObject {
       return;
     }
     if (stage == Stage::RecipeScenario) {
-      if (stage_entity_a && !stage_entity_a->is_pending_deletion() && !stage_a_done) {
-        show_marker(entity_center(stage_entity_a),
+      auto* target = stage_entity_a.get();
+      if (target && !stage_a_done) {
+        show_marker(entity_center(target),
                     engine::UIColor{0.95f, 0.35f, 0.35f, 0.9f});
       }
     }
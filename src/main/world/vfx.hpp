@@ -5,15 +5,15 @@
 #include <cmath>
 #include <limits>
 #include <string>
+#include <vector>
 
 #include "ecs/ecs.hpp"
 #include "ecs/context.hpp"
 #include "utils/arena.hpp"
-#include "utils/random.hpp"
 #include "systems/color/color_system.hpp"
 #include "systems/dynamic/dynamic_object.hpp"
+#include "systems/hidden/hidden_object.hpp"
 #include "systems/layer/layered_object.hpp"
-#include "systems/moving/moving_object.hpp"
 #include "systems/render/render_system.hpp"
 #include "systems/render/sprite_system.hpp"
 #include "systems/rotating/rotating_object.hpp"
@@ -24,6 +24,14 @@
 #include "engine/geometry_builder.h"
 #include "engine/resource_ids.h"
 
+#include "arena_tally.hpp"
+#include "mushroom_pool.hpp"
+#include "rng_streams.hpp"
+#include "sim_clock.hpp"
+#include "spawn_governor.hpp"
+#include "sprite_batch.hpp"
+#include "profiler.hpp"
+
 namespace vfx {
 
 inline float clamp01(float v) {
@@ -120,44 +128,6 @@ inline const glm::vec4 floor_lava_color{103.0f / 255.0f, 36.0f / 255.0f,
 inline constexpr int kMissBoilMushroomLayer = -2;
 inline constexpr int kMissBoilBubbleLayer = -1;
 
-struct VfxBurst : public dynamic::DynamicObject {
-  VfxBurst(glm::vec2 center, glm::vec2 base_size, BurstConfig config)
-      : dynamic::DynamicObject(),
-        center(center),
-        base_size(base_size),
-        config(std::move(config)) {}
-  ~VfxBurst() override { Component::component_count--; }
-
-  void update() override {
-    if (!entity || entity->is_pending_deletion()) return;
-    const float dt = static_cast<float>(ecs::context().delta_seconds);
-    elapsed += dt;
-    const float t = config.lifetime > 0.0f ? clamp01(elapsed / config.lifetime) : 1.0f;
-    const float scale = lerp(config.start_scale, config.end_scale, ease_out(t));
-    const float alpha = lerp(config.start_alpha, config.end_alpha, ease_in(t));
-
-    if (auto* sprite = entity->get<render_system::SpriteRenderable>()) {
-      sprite->size = base_size * scale;
-    }
-    if (auto* transform = entity->get<transform::NoRotationTransform>()) {
-      const glm::vec2 size = base_size * scale;
-      transform->pos = center - size * 0.5f;
-    }
-    if (auto* tint = entity->get<color::OneColor>()) {
-      tint->color.w = alpha;
-    }
-
-    if (elapsed >= config.lifetime) {
-      entity->mark_deleted();
-    }
-  }
-
-  glm::vec2 center{0.0f, 0.0f};
-  glm::vec2 base_size{0.0f, 0.0f};
-  BurstConfig config;
-  float elapsed = 0.0f;
-};
-
 struct CatchConsumeVanish : public dynamic::DynamicObject {
   CatchConsumeVanish(glm::vec2 start_center, glm::vec2 base_size, glm::vec2 target_center)
       : dynamic::DynamicObject(),
@@ -166,7 +136,19 @@ struct CatchConsumeVanish : public dynamic::DynamicObject {
         target_center(target_center) {}
   ~CatchConsumeVanish() override { Component::component_count--; }
 
+  // A pooled mushroom keeps this component between lives; a new catch restarts it.
+  void restart(glm::vec2 start, glm::vec2 size, glm::vec2 target) {
+    start_center = start;
+    base_size = size;
+    target_center = target;
+    phase = static_cast<float>(rng_streams::cosmetic.get_double(0.0, 6.28318530718));
+    elapsed = 0.0f;
+    active = true;
+    finished = false;
+  }
+
   void update() override {
+    if (!active || finished) return;
     if (!entity || entity->is_pending_deletion()) return;
 
     auto* sprite = entity->get<render_system::SpriteRenderable>();
@@ -203,7 +185,8 @@ struct CatchConsumeVanish : public dynamic::DynamicObject {
     }
 
     if (elapsed >= duration) {
-      entity->mark_deleted();
+      finished = true;
+      mushroom_pool::release(entity);
     }
   }
 
@@ -214,11 +197,14 @@ struct CatchConsumeVanish : public dynamic::DynamicObject {
       std::numeric_limits<float>::quiet_NaN(),
   };
   float duration = 0.45f;
-  float phase = static_cast<float>(rnd::get_double(0.0, 6.28318530718));
+  float phase = static_cast<float>(rng_streams::cosmetic.get_double(0.0, 6.28318530718));
   float wobble_ratio = 0.09f;
   float wobble_cycles = 2.6f;
   float min_scale = 0.3f;
   float elapsed = 0.0f;
+  // Active locks the mushroom from the catch until it is respawned, including while parked.
+  bool active = true;
+  bool finished = false;
 };
 
 struct MissBoilVanish : public dynamic::DynamicObject {
@@ -231,7 +217,18 @@ struct MissBoilVanish : public dynamic::DynamicObject {
         sink_distance_px(sink_distance_px) {}
   ~MissBoilVanish() override { Component::component_count--; }
 
+  void restart(glm::vec2 start, glm::vec2 new_size, float delay, float sink_distance) {
+    start_center = start;
+    size = new_size;
+    delete_delay = delay;
+    sink_distance_px = sink_distance;
+    elapsed = 0.0f;
+    active = true;
+    finished = false;
+  }
+
   void update() override {
+    if (!active || finished) return;
     if (!entity || entity->is_pending_deletion()) return;
 
     auto* transform = entity->get<transform::NoRotationTransform>();
@@ -240,7 +237,7 @@ struct MissBoilVanish : public dynamic::DynamicObject {
       return;
     }
 
-    if (auto* moving = entity->get<dynamic::MovingObject>()) {
+    if (auto* moving = entity->get<sim_clock::FixedStepMover>()) {
       moving->translate = glm::vec2{0.0f, 0.0f};
     }
     if (auto* rotating = entity->get<dynamic::RotatingObject>()) {
@@ -254,7 +251,8 @@ struct MissBoilVanish : public dynamic::DynamicObject {
     transform->pos = center - size * 0.5f;
 
     if (elapsed >= delete_delay) {
-      entity->mark_deleted();
+      finished = true;
+      mushroom_pool::release(entity);
     }
   }
 
@@ -263,6 +261,8 @@ struct MissBoilVanish : public dynamic::DynamicObject {
   float delete_delay = 0.24f;
   float sink_distance_px = 0.0f;
   float elapsed = 0.0f;
+  bool active = true;
+  bool finished = false;
 };
 
 struct SporeConfig {
@@ -298,41 +298,6 @@ inline SporeConfig spawn_warning_spore{
     4,
 };
 
-struct VfxSpore : public dynamic::DynamicObject {
-  VfxSpore(glm::vec2 center, SporeConfig config)
-      : dynamic::DynamicObject(),
-        center(center),
-        config(std::move(config)) {}
-  ~VfxSpore() override { Component::component_count--; }
-
-  void update() override {
-    if (!entity || entity->is_pending_deletion()) return;
-    const float dt = static_cast<float>(ecs::context().delta_seconds);
-    elapsed += dt;
-    const float t = config.lifetime > 0.0f ? clamp01(elapsed / config.lifetime) : 1.0f;
-    const float radius = lerp(config.start_radius, config.end_radius, ease_out(t));
-    center += config.velocity * dt;
-
-    if (auto* transform = entity->get<transform::NoRotationTransform>()) {
-      transform->pos = center - glm::vec2{radius, radius};
-    }
-    if (auto* circle = entity->get<render_system::CircleRenderable>()) {
-      auto color = config.color;
-      color.w = lerp(config.color.w, 0.0f, ease_in(t));
-      circle->radius = radius;
-      circle->color = engine::UIColor{color.x, color.y, color.z, color.w};
-    }
-
-    if (elapsed >= config.lifetime) {
-      entity->mark_deleted();
-    }
-  }
-
-  glm::vec2 center{0.0f, 0.0f};
-  SporeConfig config;
-  float elapsed = 0.0f;
-};
-
 struct BoilBubbleConfig {
   glm::vec2 start_center{0.0f, 0.0f};
   glm::vec2 end_center{0.0f, 0.0f};
@@ -349,111 +314,410 @@ struct BoilBubbleConfig {
   float wobble_px = 0.0f;
   float phase = 0.0f;
   int layer = 5;
-  int segments = 32;
 };
 
-struct BoilBubble : public dynamic::DynamicObject {
-  explicit BoilBubble(BoilBubbleConfig config)
-      : dynamic::DynamicObject(),
-        config(std::move(config)) {}
-  ~BoilBubble() override { Component::component_count--; }
+// Short-lived particles live in fixed-capacity struct-of-arrays pools, one per kind. A single
+// ParticleSystem component steps every pool each frame and one batch renderable per
+// (kind, layer) draws the live particles with a shared geometry, so spawning a particle never
+// allocates entities or components. Spawns beyond capacity or the governor's particle budget
+// are dropped.
+enum class ParticleKind {
+  Spore,
+  Burst,
+  Shatter,
+  Bubble,
+};
 
-  void update() override {
-    if (!entity || entity->is_pending_deletion()) return;
+struct SporePool {
+  static constexpr size_t kCapacity = 768;
+  size_t count = 0;
+  std::array<glm::vec2, kCapacity> center{};
+  std::array<glm::vec2, kCapacity> velocity{};
+  std::array<glm::vec4, kCapacity> color{};
+  std::array<float, kCapacity> start_radius{};
+  std::array<float, kCapacity> end_radius{};
+  std::array<float, kCapacity> lifetime{};
+  std::array<float, kCapacity> elapsed{};
+  std::array<int, kCapacity> layer{};
+  std::array<float, kCapacity> draw_radius{};
+  std::array<glm::vec4, kCapacity> draw_color{};
+
+  void remove(size_t i) {
+    const size_t last = --count;
+    center[i] = center[last];
+    velocity[i] = velocity[last];
+    color[i] = color[last];
+    start_radius[i] = start_radius[last];
+    end_radius[i] = end_radius[last];
+    lifetime[i] = lifetime[last];
+    elapsed[i] = elapsed[last];
+    layer[i] = layer[last];
+    draw_radius[i] = draw_radius[last];
+    draw_color[i] = draw_color[last];
+  }
+};
 
-    const float dt = static_cast<float>(ecs::context().delta_seconds);
-    elapsed += dt;
-    const float active_elapsed = elapsed - config.delay;
+struct BubblePool {
+  static constexpr size_t kCapacity = 256;
+  size_t count = 0;
+  std::array<glm::vec2, kCapacity> start_center{};
+  std::array<glm::vec2, kCapacity> end_center{};
+  std::array<glm::vec4, kCapacity> color{};
+  std::array<float, kCapacity> start_radius{};
+  std::array<float, kCapacity> end_radius{};
+  std::array<float, kCapacity> lifetime{};
+  std::array<float, kCapacity> delay{};
+  std::array<float, kCapacity> start_alpha{};
+  std::array<float, kCapacity> peak_alpha{};
+  std::array<float, kCapacity> end_alpha{};
+  std::array<float, kCapacity> grow_fraction{};
+  std::array<float, kCapacity> fade_start{};
+  std::array<float, kCapacity> wobble_px{};
+  std::array<float, kCapacity> phase{};
+  std::array<float, kCapacity> elapsed{};
+  std::array<int, kCapacity> layer{};
+  std::array<glm::vec2, kCapacity> center{};
+  std::array<float, kCapacity> draw_radius{};
+  std::array<glm::vec4, kCapacity> draw_color{};
+
+  void remove(size_t i) {
+    const size_t last = --count;
+    start_center[i] = start_center[last];
+    end_center[i] = end_center[last];
+    color[i] = color[last];
+    start_radius[i] = start_radius[last];
+    end_radius[i] = end_radius[last];
+    lifetime[i] = lifetime[last];
+    delay[i] = delay[last];
+    start_alpha[i] = start_alpha[last];
+    peak_alpha[i] = peak_alpha[last];
+    end_alpha[i] = end_alpha[last];
+    grow_fraction[i] = grow_fraction[last];
+    fade_start[i] = fade_start[last];
+    wobble_px[i] = wobble_px[last];
+    phase[i] = phase[last];
+    elapsed[i] = elapsed[last];
+    layer[i] = layer[last];
+    center[i] = center[last];
+    draw_radius[i] = draw_radius[last];
+    draw_color[i] = draw_color[last];
+  }
+};
+
+struct BurstPool {
+  static constexpr size_t kCapacity = 96;
+  size_t count = 0;
+  std::array<glm::vec2, kCapacity> center{};
+  std::array<glm::vec2, kCapacity> base_size{};
+  std::array<glm::vec4, kCapacity> tint{};
+  std::array<float, kCapacity> start_scale{};
+  std::array<float, kCapacity> end_scale{};
+  std::array<float, kCapacity> start_alpha{};
+  std::array<float, kCapacity> end_alpha{};
+  std::array<float, kCapacity> lifetime{};
+  std::array<float, kCapacity> elapsed{};
+  std::array<engine::TextureId, kCapacity> texture_id{};
+  std::array<engine::GeometryId, kCapacity> geometry_id{};
+  std::array<int, kCapacity> layer{};
+  std::array<glm::vec2, kCapacity> draw_pos{};
+  std::array<glm::vec2, kCapacity> draw_size{};
+  std::array<glm::vec4, kCapacity> draw_color{};
+
+  void remove(size_t i) {
+    const size_t last = --count;
+    center[i] = center[last];
+    base_size[i] = base_size[last];
+    tint[i] = tint[last];
+    start_scale[i] = start_scale[last];
+    end_scale[i] = end_scale[last];
+    start_alpha[i] = start_alpha[last];
+    end_alpha[i] = end_alpha[last];
+    lifetime[i] = lifetime[last];
+    elapsed[i] = elapsed[last];
+    texture_id[i] = texture_id[last];
+    geometry_id[i] = geometry_id[last];
+    layer[i] = layer[last];
+    draw_pos[i] = draw_pos[last];
+    draw_size[i] = draw_size[last];
+    draw_color[i] = draw_color[last];
+  }
+};
+
+struct ShatterPool {
+  static constexpr size_t kCapacity = 288;
+  size_t count = 0;
+  std::array<glm::vec2, kCapacity> center{};
+  std::array<glm::vec2, kCapacity> size{};
+  std::array<glm::vec2, kCapacity> velocity{};
+  std::array<float, kCapacity> gravity{};
+  std::array<float, kCapacity> lifetime{};
+  std::array<float, kCapacity> elapsed{};
+  std::array<engine::TextureId, kCapacity> texture_id{};
+  std::array<engine::GeometryId, kCapacity> geometry_id{};
+  std::array<int, kCapacity> layer{};
+  std::array<glm::vec2, kCapacity> draw_pos{};
+  std::array<glm::vec2, kCapacity> draw_size{};
+  std::array<glm::vec4, kCapacity> draw_color{};
+
+  void remove(size_t i) {
+    const size_t last = --count;
+    center[i] = center[last];
+    size[i] = size[last];
+    velocity[i] = velocity[last];
+    gravity[i] = gravity[last];
+    lifetime[i] = lifetime[last];
+    elapsed[i] = elapsed[last];
+    texture_id[i] = texture_id[last];
+    geometry_id[i] = geometry_id[last];
+    layer[i] = layer[last];
+    draw_pos[i] = draw_pos[last];
+    draw_size[i] = draw_size[last];
+    draw_color[i] = draw_color[last];
+  }
+};
+
+inline SporePool spore_pool{};
+inline BubblePool bubble_pool{};
+inline BurstPool burst_pool{};
+inline ShatterPool shatter_pool{};
+
+inline size_t particle_count() {
+  return spore_pool.count + bubble_pool.count + burst_pool.count + shatter_pool.count;
+}
+
+// Emitters skip particles once every pool together holds the governor's budget.
+inline bool particle_budget_spent() {
+  const float budget = spawn_governor::config.max_particles;
+  return budget > 0.0f && static_cast<float>(particle_count()) >= budget;
+}
+
+inline void clear_particles() {
+  spore_pool.count = 0;
+  bubble_pool.count = 0;
+  burst_pool.count = 0;
+  shatter_pool.count = 0;
+}
+
+inline void step_spores(float dt) {
+  auto& p = spore_pool;
+  size_t i = 0;
+  while (i < p.count) {
+    p.elapsed[i] += dt;
+    if (p.elapsed[i] >= p.lifetime[i]) {
+      p.remove(i);
+      continue;
+    }
+    const float t = p.lifetime[i] > 0.0f ? clamp01(p.elapsed[i] / p.lifetime[i]) : 1.0f;
+    p.center[i] += p.velocity[i] * dt;
+    p.draw_radius[i] = lerp(p.start_radius[i], p.end_radius[i], ease_out(t));
+    p.draw_color[i] = p.color[i];
+    p.draw_color[i].w = lerp(p.color[i].w, 0.0f, ease_in(t));
+    ++i;
+  }
+}
+
+inline void step_bubbles(float dt) {
+  auto& p = bubble_pool;
+  size_t i = 0;
+  while (i < p.count) {
+    p.elapsed[i] += dt;
+    const float active_elapsed = p.elapsed[i] - p.delay[i];
+    if (active_elapsed >= p.lifetime[i]) {
+      p.remove(i);
+      continue;
+    }
     if (active_elapsed < 0.0f) {
-      apply_state(config.start_center, std::max(0.1f, config.start_radius), 0.0f);
-      return;
+      p.center[i] = p.start_center[i];
+      p.draw_radius[i] = std::max(0.1f, p.start_radius[i]);
+      p.draw_color[i].w = 0.0f;
+      ++i;
+      continue;
     }
 
-    const float lifetime = std::max(0.001f, config.lifetime);
+    const float lifetime = std::max(0.001f, p.lifetime[i]);
     const float t = clamp01(active_elapsed / lifetime);
-    const float grow_t = clamp01(t / std::max(0.001f, config.grow_fraction));
-    const float fade_t = clamp01((t - config.fade_start) / std::max(0.001f, 1.0f - config.fade_start));
+    const float grow_t = clamp01(t / std::max(0.001f, p.grow_fraction[i]));
+    const float fade_t =
+        clamp01((t - p.fade_start[i]) / std::max(0.001f, 1.0f - p.fade_start[i]));
     const float move_t = ease_out(t);
-    const float radius = lerp(config.start_radius, config.end_radius, ease_out(grow_t));
-    float alpha = lerp(config.start_alpha, config.peak_alpha, ease_out(grow_t));
-    if (t >= config.fade_start) {
-      alpha = lerp(config.peak_alpha, config.end_alpha, ease_in(fade_t));
+    float alpha = lerp(p.start_alpha[i], p.peak_alpha[i], ease_out(grow_t));
+    if (t >= p.fade_start[i]) {
+      alpha = lerp(p.peak_alpha[i], p.end_alpha[i], ease_in(fade_t));
     }
 
     glm::vec2 center{
-        lerp(config.start_center.x, config.end_center.x, move_t),
-        lerp(config.start_center.y, config.end_center.y, move_t),
+        lerp(p.start_center[i].x, p.end_center[i].x, move_t),
+        lerp(p.start_center[i].y, p.end_center[i].y, move_t),
     };
-    center.x += std::sin(config.phase + active_elapsed * 12.0f) * config.wobble_px *
-                (1.0f - clamp01(t));
-
-    apply_state(center, radius, alpha);
+    center.x += std::sin(p.phase[i] + active_elapsed * 12.0f) * p.wobble_px[i] * (1.0f - t);
+
+    p.center[i] = center;
+    p.draw_radius[i] =
+        std::max(0.1f, lerp(p.start_radius[i], p.end_radius[i], ease_out(grow_t)));
+    p.draw_color[i] = p.color[i];
+    p.draw_color[i].w = alpha;
+    ++i;
+  }
+}
 
-    if (active_elapsed >= config.lifetime) {
-      entity->mark_deleted();
+inline void step_bursts(float dt) {
+  auto& p = burst_pool;
+  size_t i = 0;
+  while (i < p.count) {
+    p.elapsed[i] += dt;
+    if (p.elapsed[i] >= p.lifetime[i]) {
+      p.remove(i);
+      continue;
     }
+    const float t = p.lifetime[i] > 0.0f ? clamp01(p.elapsed[i] / p.lifetime[i]) : 1.0f;
+    const float scale = lerp(p.start_scale[i], p.end_scale[i], ease_out(t));
+    p.draw_size[i] = p.base_size[i] * scale;
+    p.draw_pos[i] = p.center[i] - p.draw_size[i] * 0.5f;
+    p.draw_color[i].w = lerp(p.start_alpha[i], p.end_alpha[i], ease_in(t));
+    ++i;
   }
+}
 
-  void apply_state(const glm::vec2& center, float radius, float alpha) {
-    radius = std::max(0.1f, radius);
-    if (auto* transform = entity->get<transform::NoRotationTransform>()) {
-      transform->pos = center - glm::vec2{radius, radius};
-    }
-    if (auto* circle = entity->get<render_system::CircleRenderable>()) {
-      if (std::fabs(circle->radius - radius) > 0.1f) {
-        circle->radius = radius;
-        circle->geometry = engine::geometry::make_circle(radius, config.segments);
-        circle->uploaded = false;
-      }
-      glm::vec4 color = config.color;
-      color.w = alpha;
-      circle->color = engine::UIColor{color.x, color.y, color.z, color.w};
+inline void step_shatter(float dt) {
+  auto& p = shatter_pool;
+  size_t i = 0;
+  while (i < p.count) {
+    p.elapsed[i] += dt;
+    if (p.elapsed[i] >= p.lifetime[i]) {
+      p.remove(i);
+      continue;
     }
+    p.velocity[i].y += p.gravity[i] * dt;
+    p.center[i] += p.velocity[i] * dt;
+    const float t = p.lifetime[i] > 0.0f ? clamp01(p.elapsed[i] / p.lifetime[i]) : 1.0f;
+    p.draw_pos[i] = p.center[i] - p.size[i] * 0.5f;
+    p.draw_color[i].w = 1.0f - ease_in(t);
+    ++i;
   }
+}
 
-  BoilBubbleConfig config;
-  float elapsed = 0.0f;
-};
-
-struct SpriteShatterPiece : public dynamic::DynamicObject {
-  SpriteShatterPiece(glm::vec2 center, glm::vec2 size, glm::vec2 velocity, float gravity,
-                     float lifetime)
-      : dynamic::DynamicObject(),
-        center(center),
-        size(size),
-        velocity(velocity),
-        gravity(gravity),
-        lifetime(lifetime) {}
-  ~SpriteShatterPiece() override { Component::component_count--; }
+struct ParticleSystem : public dynamic::DynamicObject {
+  ParticleSystem() : dynamic::DynamicObject() {}
+  ~ParticleSystem() override { Component::component_count--; }
 
   void update() override {
-    if (!entity || entity->is_pending_deletion()) return;
+    SHROOMS_PROFILE_ZONE("ParticleSystem");
     const float dt = static_cast<float>(ecs::context().delta_seconds);
-    elapsed += dt;
-    velocity.y += gravity * dt;
-    center += velocity * dt;
-    const float t = lifetime > 0.0f ? clamp01(elapsed / lifetime) : 1.0f;
+    step_spores(dt);
+    step_bubbles(dt);
+    step_bursts(dt);
+    step_shatter(dt);
+  }
+};
 
-    if (auto* transform = entity->get<transform::NoRotationTransform>()) {
-      transform->pos = center - size * 0.5f;
-    }
-    if (auto* tint = entity->get<color::OneColor>()) {
-      tint->color.w = 1.0f - ease_in(t);
+inline sprite_batch::SharedGeometry unit_circle_geometry{};
+
+inline engine::GeometryId ensure_unit_circle_geometry() {
+  if (unit_circle_geometry.id == engine::kInvalidGeometryId) {
+    unit_circle_geometry.id = engine::resources::register_geometry("shrooms_particle_circle");
+    unit_circle_geometry.data = engine::geometry::make_circle(1.0f, 32);
+  }
+  return unit_circle_geometry.id;
+}
+
+template <typename Pool>
+inline void emit_circle_particles(const Pool& pool, int layer, engine::RenderPass& pass) {
+  for (size_t i = 0; i < pool.count; ++i) {
+    if (pool.layer[i] != layer || pool.draw_color[i].w <= 0.0f) continue;
+    const float radius = pool.draw_radius[i];
+    engine::DrawItem item{};
+    item.geometry_id = unit_circle_geometry.id;
+    // Unit circle spans [0, 2] like CircleRenderable, which is placed by its top-left corner.
+    item.model = sprite_batch::instance_model(pool.center[i] - glm::vec2{radius, radius},
+                                glm::vec2{radius, radius});
+    const glm::vec4& c = pool.draw_color[i];
+    item.color = engine::UIColor{c.x, c.y, c.z, c.w};
+    pass.draw_items.push_back(std::move(item));
+  }
+}
+
+template <typename Pool>
+inline void emit_sprite_particles(const Pool& pool, int layer, engine::RenderPass& pass) {
+  for (size_t i = 0; i < pool.count; ++i) {
+    if (pool.layer[i] != layer || pool.draw_color[i].w <= 0.0f) continue;
+    engine::DrawItem item{};
+    item.geometry_id = pool.geometry_id[i];
+    item.model = sprite_batch::instance_model(pool.draw_pos[i], pool.draw_size[i]);
+    const glm::vec4& c = pool.draw_color[i];
+    item.color = engine::UIColor{c.x, c.y, c.z, c.w};
+    item.texture_id = pool.texture_id[i];
+    pass.draw_items.push_back(std::move(item));
+  }
+}
+
+struct CircleParticleBatch : public render_system::CircleRenderable {
+  CircleParticleBatch(ParticleKind kind, int layer)
+      : render_system::CircleRenderable(1.0f, engine::UIColor{1.0f, 1.0f, 1.0f, 1.0f}),
+        kind(kind),
+        layer(layer) {}
+
+  void emit(engine::RenderPass& pass) override {
+    sprite_batch::upload(unit_circle_geometry, pass);
+    if (kind == ParticleKind::Spore) {
+      emit_circle_particles(spore_pool, layer, pass);
+    } else {
+      emit_circle_particles(bubble_pool, layer, pass);
     }
+  }
 
-    if (elapsed >= lifetime) {
-      entity->mark_deleted();
+  ParticleKind kind = ParticleKind::Spore;
+  int layer = 0;
+};
+
+struct SpriteParticleBatch : public render_system::SpriteRenderable {
+  SpriteParticleBatch(ParticleKind kind, int layer, engine::TextureId texture_id)
+      : render_system::SpriteRenderable(texture_id, glm::vec2{1.0f, 1.0f}),
+        kind(kind),
+        layer(layer) {}
+
+  void emit(engine::RenderPass& pass) override {
+    sprite_batch::upload_pending(pass);
+    if (kind == ParticleKind::Burst) {
+      emit_sprite_particles(burst_pool, layer, pass);
+    } else {
+      emit_sprite_particles(shatter_pool, layer, pass);
     }
   }
 
-  glm::vec2 center{0.0f, 0.0f};
-  glm::vec2 size{0.0f, 0.0f};
-  glm::vec2 velocity{0.0f, 0.0f};
-  float gravity = 0.0f;
-  float lifetime = 0.3f;
-  float elapsed = 0.0f;
+  ParticleKind kind = ParticleKind::Burst;
+  int layer = 0;
+};
+
+struct ParticleBatchKey {
+  ParticleKind kind = ParticleKind::Spore;
+  int layer = 0;
 };
 
+inline ecs::Entity* particle_system_entity = nullptr;
+inline std::vector<ParticleBatchKey> particle_batches{};
+
+inline void ensure_particle_batch(ParticleKind kind, int layer, engine::TextureId texture_id) {
+  if (!particle_system_entity) {
+    particle_system_entity = arena::create<ecs::Entity>();
+    particle_system_entity->add(arena::create<ParticleSystem>());
+    ensure_unit_circle_geometry();
+  }
+  for (const auto& batch : particle_batches) {
+    if (batch.kind == kind && batch.layer == layer) return;
+  }
+  particle_batches.push_back(ParticleBatchKey{kind, layer});
+
+  auto* entity = arena::create<ecs::Entity>();
+  entity->add(arena::create<transform::NoRotationTransform>());
+  entity->add(arena::create<layers::ConstLayer>(layer));
+  if (kind == ParticleKind::Spore || kind == ParticleKind::Bubble) {
+    entity->add(arena::create<CircleParticleBatch>(kind, layer));
+  } else {
+    entity->add(arena::create<SpriteParticleBatch>(kind, layer, texture_id));
+  }
+  entity->add(arena::create<scene::SceneObject>("main"));
+}
+
 struct ScoreDeltaText : public dynamic::DynamicObject {
   ScoreDeltaText(glm::vec2 center, glm::vec2 size, glm::vec4 color, float lifetime,
                  float rise_speed_px, float drift_speed_px, float wobble_speed,
@@ -467,12 +731,24 @@ struct ScoreDeltaText : public dynamic::DynamicObject {
         drift_speed_px(drift_speed_px),
         wobble_speed(wobble_speed),
         wobble_amplitude_px(wobble_amplitude_px),
-        drift_dir(static_cast<float>(rnd::get_double(-1.0, 1.0))),
-        wobble_phase(static_cast<float>(rnd::get_double(0.0, 6.28318530718))) {}
+        drift_dir(static_cast<float>(rng_streams::cosmetic.get_double(-1.0, 1.0))),
+        wobble_phase(static_cast<float>(rng_streams::cosmetic.get_double(0.0, 6.28318530718))) {}
   ~ScoreDeltaText() override { Component::component_count--; }
 
+  // Pooled popups are rearmed instead of recreated; see spawn_score_delta.
+  void restart(glm::vec2 new_center, glm::vec2 new_size, glm::vec4 color) {
+    auto& rng = rng_streams::cosmetic;
+    center = new_center;
+    size = new_size;
+    base_color = color;
+    elapsed = 0.0f;
+    drift_dir = static_cast<float>(rng.get_double(-1.0, 1.0));
+    wobble_phase = static_cast<float>(rng.get_double(0.0, 6.28318530718));
+    active = true;
+  }
+
   void update() override {
-    if (!entity || entity->is_pending_deletion()) return;
+    if (!active || !entity || entity->is_pending_deletion()) return;
     const float dt = static_cast<float>(ecs::context().delta_seconds);
     elapsed += dt;
     const float t = lifetime > 0.0f ? clamp01(elapsed / lifetime) : 1.0f;
@@ -490,7 +766,10 @@ struct ScoreDeltaText : public dynamic::DynamicObject {
     }
 
     if (elapsed >= lifetime) {
-      entity->mark_deleted();
+      active = false;
+      if (auto* hidden = entity->get<hidden::HiddenObject>()) {
+        hidden->hide();
+      }
     }
   }
 
@@ -505,6 +784,7 @@ struct ScoreDeltaText : public dynamic::DynamicObject {
   float drift_dir = 0.0f;
   float wobble_phase = 0.0f;
   float elapsed = 0.0f;
+  bool active = true;
 };
 
 struct WobbleOffset;
@@ -565,52 +845,82 @@ inline void reset_wobble_offsets() {
 inline void attach_wobble(ecs::Entity* entity, const glm::vec2& amplitude_px, float speed,
                           bool respect_pause = true) {
   if (!entity) return;
-  const float phase = static_cast<float>(rnd::get_double(0.0, 6.28318));
+  const float phase = static_cast<float>(rng_streams::gameplay.get_double(0.0, 6.28318));
   entity->add(arena::create<WobbleOffset>(amplitude_px, speed, phase, respect_pause));
 }
 
+// Pooled entities keep their wobble; this restarts it with `speed` and a phase drawn exactly as
+// attach_wobble() draws it.
+inline void restart_wobble(ecs::Entity* entity, float speed) {
+  if (!entity) return;
+  const float phase = static_cast<float>(rng_streams::gameplay.get_double(0.0, 6.28318));
+  auto* wobble = entity->get<WobbleOffset>();
+  if (!wobble) return;
+  wobble->speed = speed;
+  wobble->phase = phase;
+  wobble->anim_time = 0.0f;
+  wobble->last_offset = glm::vec2{0.0f, 0.0f};
+}
+
 inline void spawn_spore(const glm::vec2& center, const SporeConfig& config) {
-  auto* entity = arena::create<ecs::Entity>();
-  const float radius = config.start_radius;
-  auto* transform = arena::create<transform::NoRotationTransform>();
-  transform->pos = center - glm::vec2{radius, radius};
-  entity->add(transform);
-  entity->add(arena::create<layers::ConstLayer>(config.layer));
-  entity->add(arena::create<render_system::CircleRenderable>(
-      radius, engine::UIColor{config.color.x, config.color.y, config.color.z, config.color.w}));
-  entity->add(arena::create<VfxSpore>(center, config));
-  entity->add(arena::create<scene::SceneObject>("main"));
+  auto& p = spore_pool;
+  if (p.count >= SporePool::kCapacity || particle_budget_spent()) return;
+  ensure_particle_batch(ParticleKind::Spore, config.layer, engine::kInvalidTextureId);
+  const size_t i = p.count++;
+  p.center[i] = center;
+  p.velocity[i] = config.velocity;
+  p.color[i] = config.color;
+  p.start_radius[i] = config.start_radius;
+  p.end_radius[i] = config.end_radius;
+  p.lifetime[i] = config.lifetime;
+  p.elapsed[i] = 0.0f;
+  p.layer[i] = config.layer;
+  p.draw_radius[i] = config.start_radius;
+  p.draw_color[i] = config.color;
 }
 
 inline void spawn_boil_bubble(const BoilBubbleConfig& config) {
-  auto* entity = arena::create<ecs::Entity>();
-  const float radius = std::max(0.1f, config.start_radius);
-  auto* transform = arena::create<transform::NoRotationTransform>();
-  transform->pos = config.start_center - glm::vec2{radius, radius};
-  entity->add(transform);
-  entity->add(arena::create<layers::ConstLayer>(config.layer));
-  glm::vec4 color = config.color;
-  color.w = config.start_alpha;
-  entity->add(arena::create<render_system::CircleRenderable>(
-      radius, engine::UIColor{color.x, color.y, color.z, color.w}));
-  entity->add(arena::create<BoilBubble>(config));
-  entity->add(arena::create<scene::SceneObject>("main"));
+  auto& p = bubble_pool;
+  if (p.count >= BubblePool::kCapacity || particle_budget_spent()) return;
+  ensure_particle_batch(ParticleKind::Bubble, config.layer, engine::kInvalidTextureId);
+  const size_t i = p.count++;
+  p.start_center[i] = config.start_center;
+  p.end_center[i] = config.end_center;
+  p.color[i] = config.color;
+  p.start_radius[i] = config.start_radius;
+  p.end_radius[i] = config.end_radius;
+  p.lifetime[i] = config.lifetime;
+  p.delay[i] = config.delay;
+  p.start_alpha[i] = config.start_alpha;
+  p.peak_alpha[i] = config.peak_alpha;
+  p.end_alpha[i] = config.end_alpha;
+  p.grow_fraction[i] = config.grow_fraction;
+  p.fade_start[i] = config.fade_start;
+  p.wobble_px[i] = config.wobble_px;
+  p.phase[i] = config.phase;
+  p.elapsed[i] = 0.0f;
+  p.layer[i] = config.layer;
+  p.center[i] = config.start_center;
+  p.draw_radius[i] = std::max(0.1f, config.start_radius);
+  p.draw_color[i] = config.color;
+  p.draw_color[i].w = config.delay > 0.0f ? 0.0f : config.start_alpha;
 }
 
 inline void spawn_spore_cloud(const glm::vec2& center, float base_radius, int count,
                               const glm::vec4& color, float spread_px, float speed_px,
                               float lifetime, int layer) {
+  auto& rng = rng_streams::cosmetic;
   for (int i = 0; i < count; ++i) {
-    const float ang = static_cast<float>(rnd::get_double(0.0, 6.28318));
-    const float dist = static_cast<float>(rnd::get_double(0.0, spread_px));
+    const float ang = static_cast<float>(rng.get_double(0.0, 6.28318));
+    const float dist = static_cast<float>(rng.get_double(0.0, spread_px));
     const glm::vec2 offset{std::cos(ang) * dist, std::sin(ang) * dist};
-    const float vel = static_cast<float>(rnd::get_double(speed_px * 0.4f, speed_px));
+    const float vel = static_cast<float>(rng.get_double(speed_px * 0.4f, speed_px));
     const glm::vec2 velocity{std::cos(ang) * vel, std::sin(ang) * vel - speed_px * 0.3f};
     SporeConfig config{};
     config.color = color;
-    config.lifetime = static_cast<float>(rnd::get_double(lifetime * 0.7f, lifetime * 1.15f));
-    config.start_radius = static_cast<float>(rnd::get_double(base_radius * 0.6f, base_radius));
-    config.end_radius = static_cast<float>(rnd::get_double(base_radius * 1.2f, base_radius * 2.2f));
+    config.lifetime = static_cast<float>(rng.get_double(lifetime * 0.7f, lifetime * 1.15f));
+    config.start_radius = static_cast<float>(rng.get_double(base_radius * 0.6f, base_radius));
+    config.end_radius = static_cast<float>(rng.get_double(base_radius * 1.2f, base_radius * 2.2f));
     config.velocity = velocity;
     config.layer = layer;
     spawn_spore(center + offset, config);
@@ -619,19 +929,28 @@ inline void spawn_spore_cloud(const glm::vec2& center, float base_radius, int co
 
 inline void spawn_burst_at(const glm::vec2& center, const glm::vec2& size,
                            const BurstConfig& config) {
-  auto* entity = arena::create<ecs::Entity>();
-  auto* transform = arena::create<transform::NoRotationTransform>();
-  const glm::vec2 scaled_size = size * config.base_scale;
-  transform->pos = center - scaled_size * 0.5f;
-  entity->add(transform);
-  entity->add(arena::create<layers::ConstLayer>(config.layer));
+  auto& p = burst_pool;
+  if (p.count >= BurstPool::kCapacity || particle_budget_spent()) return;
   const engine::TextureId tex_id = engine::resources::register_texture(config.texture);
-  entity->add(arena::create<render_system::SpriteRenderable>(tex_id, scaled_size));
-  glm::vec4 tint = config.tint;
-  tint.w = config.start_alpha;
-  entity->add(arena::create<color::OneColor>(tint));
-  entity->add(arena::create<VfxBurst>(center, scaled_size, config));
-  entity->add(arena::create<scene::SceneObject>("main"));
+  ensure_particle_batch(ParticleKind::Burst, config.layer, tex_id);
+  const glm::vec2 scaled_size = size * config.base_scale;
+  const size_t i = p.count++;
+  p.center[i] = center;
+  p.base_size[i] = scaled_size;
+  p.tint[i] = config.tint;
+  p.start_scale[i] = config.start_scale;
+  p.end_scale[i] = config.end_scale;
+  p.start_alpha[i] = config.start_alpha;
+  p.end_alpha[i] = config.end_alpha;
+  p.lifetime[i] = config.lifetime;
+  p.elapsed[i] = 0.0f;
+  p.texture_id[i] = tex_id;
+  p.geometry_id[i] = sprite_batch::unit_quad().id;
+  p.layer[i] = config.layer;
+  p.draw_size[i] = scaled_size * config.start_scale;
+  p.draw_pos[i] = center - p.draw_size[i] * 0.5f;
+  p.draw_color[i] = config.tint;
+  p.draw_color[i].w = config.start_alpha;
 }
 
 inline glm::vec2 entity_size(ecs::Entity* entity) {
@@ -651,11 +970,26 @@ inline glm::vec2 entity_center(ecs::Entity* entity, const glm::vec2& size) {
 }
 
 inline bool is_catch_animating(const ecs::Entity* entity) {
-  return entity && entity->get<CatchConsumeVanish>();
+  if (!entity) return false;
+  const auto* vanish = entity->get<CatchConsumeVanish>();
+  return vanish && vanish->active;
+}
+
+inline bool is_miss_animating(const ecs::Entity* entity) {
+  if (!entity) return false;
+  const auto* vanish = entity->get<MissBoilVanish>();
+  return vanish && vanish->active;
 }
 
 inline bool is_mushroom_vfx_locked(const ecs::Entity* entity) {
-  return entity && (entity->get<CatchConsumeVanish>() || entity->get<MissBoilVanish>());
+  return is_catch_animating(entity) || is_miss_animating(entity);
+}
+
+// Called when a pooled mushroom is respawned: its vanish components stay attached but go idle.
+inline void unlock_mushroom_vfx(ecs::Entity* entity) {
+  if (!entity) return;
+  if (auto* vanish = entity->get<CatchConsumeVanish>()) vanish->active = false;
+  if (auto* vanish = entity->get<MissBoilVanish>()) vanish->active = false;
 }
 
 inline void start_catch_consume_vanish(
@@ -678,24 +1012,28 @@ inline void start_catch_consume_vanish(
     return;
   }
 
-  if (auto* moving = entity->get<dynamic::MovingObject>()) {
+  if (auto* moving = entity->get<sim_clock::FixedStepMover>()) {
     moving->translate = glm::vec2{0.0f, 0.0f};
   }
   if (auto* rotating = entity->get<dynamic::RotatingObject>()) {
     rotating->angle = 0.0f;
   }
   if (!entity->get<color::OneColor>()) {
-    entity->add(arena::create<color::OneColor>(glm::vec4{1.0f, 1.0f, 1.0f, 1.0f}));
+    entity->add(arena_tally::create<color::OneColor>(glm::vec4{1.0f, 1.0f, 1.0f, 1.0f}));
   }
   constexpr int kConsumeLayer = -1;
   if (auto* layer = entity->get<layers::ConstLayer>()) {
     layer->layer = std::min(layer->layer, kConsumeLayer);
   } else {
-    entity->add(arena::create<layers::ConstLayer>(kConsumeLayer));
+    entity->add(arena_tally::create<layers::ConstLayer>(kConsumeLayer));
   }
 
   const glm::vec2 center = entity_center(entity, size);
-  entity->add(arena::create<CatchConsumeVanish>(center, size, target_center));
+  if (auto* vanish = entity->get<CatchConsumeVanish>()) {
+    vanish->restart(center, size, target_center);
+  } else {
+    entity->add(arena_tally::create<CatchConsumeVanish>(center, size, target_center));
+  }
 }
 
 inline void spawn_spawn_effect(const glm::vec2& center, const glm::vec2& size) {
@@ -728,6 +1066,7 @@ inline void spawn_catch_effect(
 }
 
 inline bool spawn_miss_effect(ecs::Entity* entity) {
+  auto& rng = rng_streams::cosmetic;
   if (!entity || entity->is_pending_deletion()) return false;
   if (is_mushroom_vfx_locked(entity)) return false;
   const glm::vec2 size = entity_size(entity);
@@ -739,82 +1078,84 @@ inline bool spawn_miss_effect(ecs::Entity* entity) {
   if (auto* layer = entity->get<layers::ConstLayer>()) {
     layer->layer = std::min(layer->layer, kMissBoilMushroomLayer);
   } else {
-    entity->add(arena::create<layers::ConstLayer>(kMissBoilMushroomLayer));
+    entity->add(arena_tally::create<layers::ConstLayer>(kMissBoilMushroomLayer));
+  }
+  if (auto* vanish = entity->get<MissBoilVanish>()) {
+    vanish->restart(center, size, delete_delay, sink_distance);
+  } else {
+    entity->add(arena_tally::create<MissBoilVanish>(center, size, delete_delay, sink_distance));
   }
-  entity->add(arena::create<MissBoilVanish>(center, size, delete_delay, sink_distance));
 
   const glm::vec2 lava_center = center + glm::vec2{0.0f, size.y * 0.46f};
   const glm::vec2 gulp_center = center + glm::vec2{0.0f, size.y * 0.08f};
   const float cluster_spread_x = std::max(5.0f, extent * 0.24f);
   const float cluster_spread_y = std::max(4.0f, extent * 0.14f);
 
-  const int gulp_count = rnd::get_int(7, 10);
+  const int gulp_count = rng.get_int(7, 10);
   for (int i = 0; i < gulp_count; ++i) {
-    const float angle = static_cast<float>(rnd::get_double(0.0, 6.28318530718));
-    const float radius_t = std::sqrt(static_cast<float>(rnd::get_double(0.0, 1.0)));
+    const float angle = static_cast<float>(rng.get_double(0.0, 6.28318530718));
+    const float radius_t = std::sqrt(static_cast<float>(rng.get_double(0.0, 1.0)));
     const glm::vec2 cluster_offset{
         std::cos(angle) * cluster_spread_x * radius_t,
         std::sin(angle) * cluster_spread_y * radius_t,
     };
     const glm::vec2 rise_jitter{
-        static_cast<float>(rnd::get_double(-extent * 0.04f, extent * 0.04f)),
-        static_cast<float>(rnd::get_double(extent * 0.02f, extent * 0.12f)),
+        static_cast<float>(rng.get_double(-extent * 0.04f, extent * 0.04f)),
+        static_cast<float>(rng.get_double(extent * 0.02f, extent * 0.12f)),
     };
     const float start_radius =
-        static_cast<float>(rnd::get_double(std::max(1.5f, extent * 0.045f),
-                                           std::max(1.5f, extent * 0.045f)));
+        static_cast<float>(rng.get_double(std::max(1.5f, extent * 0.045f),
+                                          std::max(1.5f, extent * 0.045f)));
     const float end_radius =
-        static_cast<float>(rnd::get_double(std::max(start_radius * 1.8f, extent * 0.075f),
-                                           std::max(start_radius * 2.6f, extent * 0.13f)));
+        static_cast<float>(rng.get_double(std::max(start_radius * 1.8f, extent * 0.075f),
+                                          std::max(start_radius * 2.6f, extent * 0.13f)));
     BoilBubbleConfig gulp{};
     gulp.start_center = lava_center + cluster_offset * 0.45f + rise_jitter;
     gulp.end_center = gulp_center + cluster_offset;
     gulp.color = floor_lava_color;
     gulp.start_radius = start_radius;
     gulp.end_radius = end_radius;
-    gulp.lifetime = static_cast<float>(rnd::get_double(0.66, 0.78));
-    gulp.delay = static_cast<float>(rnd::get_double(0.0, 0.12)) + static_cast<float>(i) * 0.008f;
+    gulp.lifetime = static_cast<float>(rng.get_double(0.66, 0.78));
+    gulp.delay = static_cast<float>(rng.get_double(0.0, 0.12)) + static_cast<float>(i) * 0.008f;
     gulp.start_alpha = 1.0f;
     gulp.peak_alpha = 1.0f;
     gulp.end_alpha = 0.0f;
     gulp.grow_fraction = 0.34f;
     gulp.fade_start = 0.58f;
     gulp.wobble_px = extent * 0.018f;
-    gulp.phase = static_cast<float>(rnd::get_double(0.0, 6.28318530718));
+    gulp.phase = static_cast<float>(rng.get_double(0.0, 6.28318530718));
     gulp.layer = kMissBoilBubbleLayer;
-    gulp.segments = 36;
     spawn_boil_bubble(gulp);
   }
 
   const int small_count = 9;
   const float spread_x = std::max(8.0f, size.x * 0.7f);
   for (int i = 0; i < small_count; ++i) {
-    const float delay = static_cast<float>(rnd::get_double(0.0, 0.16));
-    const float side = static_cast<float>(rnd::get_double(-1.0, 1.0));
+    const float delay = static_cast<float>(rng.get_double(0.0, 0.16));
+    const float side = static_cast<float>(rng.get_double(-1.0, 1.0));
     const float start_radius = static_cast<float>(
-        rnd::get_double(std::max(2.0f, extent * 0.045f), std::max(3.5f, extent * 0.12f)));
+        rng.get_double(std::max(2.0f, extent * 0.045f), std::max(3.5f, extent * 0.12f)));
     BoilBubbleConfig bubble{};
     bubble.start_center =
-        lava_center + glm::vec2{side * spread_x * static_cast<float>(rnd::get_double(0.05, 0.55)),
-                                static_cast<float>(rnd::get_double(0.0, extent * 0.2f))};
+        lava_center + glm::vec2{side * spread_x * static_cast<float>(rng.get_double(0.05, 0.55)),
+                                static_cast<float>(rng.get_double(0.0, extent * 0.2f))};
     bubble.end_center =
-        bubble.start_center + glm::vec2{side * static_cast<float>(rnd::get_double(2.0, 12.0)),
-                                        -static_cast<float>(rnd::get_double(extent * 0.45f,
-                                                                            extent * 0.95f))};
+        bubble.start_center + glm::vec2{side * static_cast<float>(rng.get_double(2.0, 12.0)),
+                                        -static_cast<float>(rng.get_double(extent * 0.45f,
+                                                                           extent * 0.95f))};
     bubble.color = floor_lava_color;
     bubble.start_radius = start_radius;
-    bubble.end_radius = start_radius * static_cast<float>(rnd::get_double(1.7, 2.8));
-    bubble.lifetime = static_cast<float>(rnd::get_double(0.45, 0.82));
+    bubble.end_radius = start_radius * static_cast<float>(rng.get_double(1.7, 2.8));
+    bubble.lifetime = static_cast<float>(rng.get_double(0.45, 0.82));
     bubble.delay = delay;
     bubble.start_alpha = 1.0f;
     bubble.peak_alpha = 1.0f;
     bubble.end_alpha = 0.0f;
-    bubble.grow_fraction = static_cast<float>(rnd::get_double(0.26, 0.42));
-    bubble.fade_start = static_cast<float>(rnd::get_double(0.42, 0.58));
-    bubble.wobble_px = static_cast<float>(rnd::get_double(extent * 0.03f, extent * 0.14f));
-    bubble.phase = static_cast<float>(rnd::get_double(0.0, 6.28318530718));
+    bubble.grow_fraction = static_cast<float>(rng.get_double(0.26, 0.42));
+    bubble.fade_start = static_cast<float>(rng.get_double(0.42, 0.58));
+    bubble.wobble_px = static_cast<float>(rng.get_double(extent * 0.03f, extent * 0.14f));
+    bubble.phase = static_cast<float>(rng.get_double(0.0, 6.28318530718));
     bubble.layer = kMissBoilBubbleLayer;
-    bubble.segments = 28;
     spawn_boil_bubble(bubble);
   }
 
@@ -836,6 +1177,7 @@ inline void spawn_sort_effect(ecs::Entity* entity) {
 }
 
 inline void spawn_sprite_shatter(ecs::Entity* entity, int columns = 3, int rows = 3) {
+  auto& rng = rng_streams::cosmetic;
   if (!entity) return;
   auto* sprite = entity->get<render_system::SpriteRenderable>();
   auto* transform = entity->get<transform::NoRotationTransform>();
@@ -860,52 +1202,54 @@ inline void spawn_sprite_shatter(ecs::Entity* entity, int columns = 3, int rows
   const float min_speed = std::max(90.0f, extent * 1.6f);
   const float max_speed = std::max(130.0f, extent * 2.35f);
 
+  ensure_particle_batch(ParticleKind::Shatter, base_layer, sprite->texture_id);
+  auto& p = shatter_pool;
   for (int y = 0; y < rows; ++y) {
     for (int x = 0; x < columns; ++x) {
-      auto* piece = arena::create<ecs::Entity>();
-
       const glm::vec2 top_left = transform->pos +
                                  glm::vec2{piece_size.x * static_cast<float>(x),
                                            piece_size.y * static_cast<float>(y)};
       const glm::vec2 piece_center = top_left + piece_size * 0.5f;
 
-      auto* piece_transform = arena::create<transform::NoRotationTransform>();
-      piece_transform->pos = top_left;
-      piece->add(piece_transform);
-      piece->add(arena::create<layers::ConstLayer>(base_layer));
-
-      auto* piece_sprite =
-          arena::create<render_system::SpriteRenderable>(sprite->texture_id, piece_size);
-      const float u0 = static_cast<float>(x) / static_cast<float>(columns);
-      const float v0 = static_cast<float>(y) / static_cast<float>(rows);
-      const float u1 = static_cast<float>(x + 1) / static_cast<float>(columns);
-      const float v1 = static_cast<float>(y + 1) / static_cast<float>(rows);
-      const std::array<float, 8> uvs{u0, v0, u1, v0, u0, v1, u1, v1};
-      piece_sprite->geometry = engine::geometry::make_quad(piece_size.x, piece_size.y, uvs);
-      piece->add(piece_sprite);
-      piece->add(arena::create<color::OneColor>(glm::vec4{1.0f, 1.0f, 1.0f, 1.0f}));
-
       glm::vec2 direction = piece_center - center;
       if (glm::length(direction) <= 0.0001f) {
         direction = glm::vec2{
-            static_cast<float>(rnd::get_double(-0.8, 0.8)),
-            static_cast<float>(rnd::get_double(-1.0, 0.4)),
+            static_cast<float>(rng.get_double(-0.8, 0.8)),
+            static_cast<float>(rng.get_double(-1.0, 0.4)),
         };
       }
-      direction.x += static_cast<float>(rnd::get_double(-0.28, 0.28));
-      direction.y += static_cast<float>(rnd::get_double(-0.24, 0.24));
+      direction.x += static_cast<float>(rng.get_double(-0.28, 0.28));
+      direction.y += static_cast<float>(rng.get_double(-0.24, 0.24));
       if (glm::length(direction) <= 0.0001f) {
         direction = glm::vec2{0.0f, -1.0f};
       } else {
         direction = glm::normalize(direction);
       }
 
-      const float speed = static_cast<float>(rnd::get_double(min_speed, max_speed));
+      const float speed = static_cast<float>(rng.get_double(min_speed, max_speed));
       const glm::vec2 velocity = direction * speed + glm::vec2{0.0f, -speed * 0.18f};
-      const float lifetime = static_cast<float>(rnd::get_double(0.24, 0.38));
-      piece->add(arena::create<SpriteShatterPiece>(piece_center, piece_size, velocity, 540.0f,
-                                                   lifetime));
-      piece->add(arena::create<scene::SceneObject>("main"));
+      const float lifetime = static_cast<float>(rng.get_double(0.24, 0.38));
+      if (p.count >= ShatterPool::kCapacity || particle_budget_spent()) continue;
+
+      const size_t i = p.count++;
+      p.center[i] = piece_center;
+      p.size[i] = piece_size;
+      p.velocity[i] = velocity;
+      p.gravity[i] = 540.0f;
+      p.lifetime[i] = lifetime;
+      p.elapsed[i] = 0.0f;
+      sprite_batch::UvRect cell{
+          static_cast<float>(x) / static_cast<float>(columns),
+          static_cast<float>(y) / static_cast<float>(rows),
+          static_cast<float>(x + 1) / static_cast<float>(columns),
+          static_cast<float>(y + 1) / static_cast<float>(rows),
+      };
+      p.texture_id[i] = sprite_batch::resolve(sprite->texture_id, cell);
+      p.geometry_id[i] = sprite_batch::unit_quad(cell).id;
+      p.layer[i] = base_layer;
+      p.draw_pos[i] = top_left;
+      p.draw_size[i] = piece_size;
+      p.draw_color[i] = glm::vec4{1.0f, 1.0f, 1.0f, 1.0f};
     }
   }
 }
@@ -936,10 +1280,13 @@ inline void spawn_spawn_warning(const glm::vec2& center, const glm::vec2& size,
   spawn_spore(center, config);
 }
 
+// Columns and rows of the destroy shatter; lowered by adaptive_quality.
+inline int shatter_grid = 3;
+
 inline void spawn_destroy_effect(ecs::Entity* entity) {
   if (!entity) return;
   spawn_sort_effect(entity);
-  spawn_sprite_shatter(entity, 3, 3);
+  spawn_sprite_shatter(entity, shatter_grid, shatter_grid);
   const glm::vec2 size = entity_size(entity);
   if (size.x <= 0.0f || size.y <= 0.0f) return;
   const glm::vec2 center = entity_center(entity, size);
@@ -951,6 +1298,65 @@ inline void spawn_destroy_effect(ecs::Entity* entity) {
                     0.34f, sort_burst.layer + 2);
 }
 
+// Score popups fire on every catch, miss and sort, so they come from a fixed ring of entities
+// that are hidden when idle instead of being created and deleted per event.
+inline constexpr size_t kScoreDeltaPoolSize = 12;
+
+struct ScoreDeltaSlot {
+  ScoreDeltaText* popup = nullptr;
+  text::TextObject* text = nullptr;
+  color::OneColor* tint = nullptr;
+  transform::NoRotationTransform* transform = nullptr;
+  hidden::HiddenObject* hidden = nullptr;
+};
+
+inline std::array<ScoreDeltaSlot, kScoreDeltaPoolSize> score_delta_pool{};
+inline size_t score_delta_next = 0;
+
+inline ScoreDeltaSlot& acquire_score_delta_slot() {
+  // Prefer an idle popup; when all are live, recycle the oldest one.
+  size_t index = score_delta_next;
+  for (size_t i = 0; i < kScoreDeltaPoolSize; ++i) {
+    const size_t candidate = (score_delta_next + i) % kScoreDeltaPoolSize;
+    const auto& slot = score_delta_pool[candidate];
+    if (!slot.popup || !slot.popup->active) {
+      index = candidate;
+      break;
+    }
+  }
+  score_delta_next = (index + 1) % kScoreDeltaPoolSize;
+
+  auto& slot = score_delta_pool[index];
+  if (!slot.popup) {
+    auto* entity = arena::create<ecs::Entity>();
+    slot.transform = arena::create<transform::NoRotationTransform>();
+    entity->add(slot.transform);
+    entity->add(arena::create<layers::ConstLayer>(score_delta_config.layer));
+    slot.text = arena::create<text::TextObject>("", score_delta_config.font_px);
+    entity->add(slot.text);
+    slot.tint = arena::create<color::OneColor>(glm::vec4{1.0f, 1.0f, 1.0f, 0.0f});
+    entity->add(slot.tint);
+    slot.hidden = arena::create<hidden::HiddenObject>();
+    entity->add(slot.hidden);
+    slot.popup = arena::create<ScoreDeltaText>(
+        glm::vec2{0.0f, 0.0f}, glm::vec2{0.0f, 0.0f}, glm::vec4{1.0f, 1.0f, 1.0f, 1.0f},
+        score_delta_config.lifetime, score_delta_config.rise_speed_px,
+        score_delta_config.drift_speed_px, score_delta_config.wobble_speed,
+        score_delta_config.wobble_amplitude_px);
+    entity->add(slot.popup);
+    entity->add(arena::create<scene::SceneObject>("main"));
+  }
+  return slot;
+}
+
+inline size_t score_deltas_active() {
+  size_t count = 0;
+  for (const auto& slot : score_delta_pool) {
+    if (slot.popup && slot.popup->active) ++count;
+  }
+  return count;
+}
+
 inline void spawn_score_delta(const glm::vec2& center, int delta) {
   if (delta == 0) return;
   const std::string text = (delta > 0 ? "+" : "") + std::to_string(delta);
@@ -959,18 +1365,12 @@ inline void spawn_score_delta(const glm::vec2& center, int delta) {
   const glm::vec2 start = center + score_delta_config.offset_px;
   const glm::vec4 color = delta > 0 ? score_delta_config.positive_color : score_delta_config.negative_color;
 
-  auto* entity = arena::create<ecs::Entity>();
-  auto* transform = arena::create<transform::NoRotationTransform>();
-  transform->pos = start - size * 0.5f;
-  entity->add(transform);
-  entity->add(arena::create<layers::ConstLayer>(score_delta_config.layer));
-  entity->add(arena::create<text::TextObject>(text, score_delta_config.font_px));
-  entity->add(arena::create<color::OneColor>(color));
-  entity->add(arena::create<ScoreDeltaText>(
-      start, size, color, score_delta_config.lifetime, score_delta_config.rise_speed_px,
-      score_delta_config.drift_speed_px, score_delta_config.wobble_speed,
-      score_delta_config.wobble_amplitude_px));
-  entity->add(arena::create<scene::SceneObject>("main"));
+  auto& slot = acquire_score_delta_slot();
+  slot.text->text = text;
+  slot.tint->color = color;
+  slot.transform->pos = start - size * 0.5f;
+  slot.popup->restart(start, size, color);
+  slot.hidden->show();
 }
 
 }  // namespace vfx
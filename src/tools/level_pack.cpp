@@ -0,0 +1,321 @@
+// Validates assets/levels.data and assets/mushrooms.data and compiles them into the binary level
+// pack read at startup (see src/main/world/level_pack.hpp). Any schema error fails with the
+// file and line; the output is only rewritten when its bytes change. The pack records a hash
+// of both sources so the game can tell when it is stale.
+//
+//   shrooms_level_pack <levels.data> <mushrooms.data> <output.pack>
+
+#include <cstdint>
+#include <fstream>
+#include <iostream>
+#include <iterator>
+#include <set>
+#include <sstream>
+#include <string>
+#include <unordered_map>
+#include <utility>
+#include <vector>
+
+#include "world/level_pack.hpp"
+
+namespace {
+
+struct Token {
+  std::string text;
+  int line = 0;
+};
+
+class Tokens {
+ public:
+  Tokens(std::string file, std::istream& in) : file_(std::move(file)) {
+    std::string line;
+    int number = 0;
+    while (std::getline(in, line)) {
+      ++number;
+      std::istringstream words(line);
+      std::string word;
+      while (words >> word) tokens_.push_back(Token{word, number});
+    }
+  }
+
+  bool done() const { return next_ >= tokens_.size(); }
+  bool failed() const { return failed_; }
+
+  const std::string& peek() const {
+    static const std::string end{};
+    return done() ? end : tokens_[next_].text;
+  }
+
+  std::string word(const char* what) {
+    if (done()) {
+      error(std::string("expected ") + what + ", got end of file");
+      return {};
+    }
+    return tokens_[next_++].text;
+  }
+
+  template <typename T>
+  T number(const char* what) {
+    const int line = current_line();
+    const std::string text = word(what);
+    std::istringstream in(text);
+    T value{};
+    if (!(in >> value) || in.peek() != std::char_traits<char>::eof()) {
+      error_at(line, std::string("expected ") + what + ", got '" + text + "'");
+      return T{};
+    }
+    return value;
+  }
+
+  void error(const std::string& message) { error_at(current_line(), message); }
+
+  void error_at(int line, const std::string& message) {
+    failed_ = true;
+    std::cerr << file_ << ":" << line << ": " << message << std::endl;
+  }
+
+  int current_line() const {
+    if (tokens_.empty()) return 0;
+    return done() ? tokens_.back().line : tokens_[next_].line;
+  }
+
+ private:
+  std::string file_;
+  std::vector<Token> tokens_{};
+  size_t next_ = 0;
+  bool failed_ = false;
+};
+
+class Compiler {
+ public:
+  uint32_t intern(const std::string& value) {
+    const auto it = string_index_.find(value);
+    if (it != string_index_.end()) return it->second;
+    const auto index = static_cast<uint32_t>(pack.strings.size());
+    pack.strings.push_back(value);
+    string_index_.emplace(value, index);
+    return index;
+  }
+
+  // Mirrors level_loader::compile_entity, but rejects anything the runtime would skip.
+  uint32_t compile_entity(Tokens& in, bool root) {
+    const int start_line = in.current_line();
+    const std::string name = in.word("entity name");
+    if (in.failed()) return level_pack::kNone;
+
+    level_pack::Entity entity{};
+    entity.name = intern(name);
+    entity.root = root ? 1 : 0;
+    bool closed = false;
+    while (!in.done() && !in.failed()) {
+      const int line = in.current_line();
+      const std::string comp = in.word("component");
+      if (comp == name) {
+        closed = true;
+        break;
+      }
+      level_pack::Component component{};
+      if (comp == "geometry") {
+        component.kind = level_pack::ComponentKind::Geometry;
+        const std::string type = in.word("geometry type");
+        int count = 4;
+        if (type == "quad") {
+          component.geometry_type = level_pack::GeometryType::Quad;
+        } else if (type == "polygon") {
+          component.geometry_type = level_pack::GeometryType::Polygon;
+          count = in.number<int>("polygon point count");
+          if (count < 3) in.error_at(line, "polygon needs at least 3 points");
+        } else {
+          in.error_at(line, "unknown geometry type '" + type + "'");
+        }
+        for (int i = 0; i < count * 2 && !in.failed(); ++i) {
+          component.points.push_back(in.number<float>("point coordinate"));
+        }
+      } else if (comp == "texture") {
+        if (entity.texture != level_pack::kNone) in.error_at(line, "duplicate texture");
+        entity.texture = intern(in.word("texture name"));
+        continue;
+      } else if (comp == "color") {
+        component.kind = level_pack::ComponentKind::Color;
+        for (auto& channel : component.color) {
+          const int value = in.number<int>("color channel");
+          if (value < 0 || value > 255) in.error_at(line, "color channel out of 0..255");
+          channel = static_cast<uint8_t>(value);
+        }
+      } else if (comp == "layer") {
+        component.kind = level_pack::ComponentKind::Layer;
+        component.layer = in.number<int32_t>("layer");
+      } else if (comp == "moving") {
+        component.kind = level_pack::ComponentKind::Moving;
+        component.move_x = in.number<float>("moving x");
+        component.move_y = in.number<float>("moving y");
+      } else if (comp == "rotating") {
+        component.kind = level_pack::ComponentKind::Rotating;
+        if (in.peek() == "random") {
+          in.word("random");
+          component.angle_random = 1;
+          component.angle_min = in.number<float>("random min");
+          component.angle_max = in.number<float>("random max");
+        } else {
+          component.angle_value = in.number<float>("rotation speed");
+        }
+      } else if (comp == "collider" || comp == "trigger") {
+        component.kind = comp == "collider" ? level_pack::ComponentKind::Collider
+                                            : level_pack::ComponentKind::Trigger;
+        component.handler = intern(in.word("handler name"));
+      } else if (comp == "periodic_spawner") {
+        component.kind = level_pack::ComponentKind::PeriodicSpawner;
+        component.spawner_period = in.number<float>("spawner period");
+        component.spawner_density = in.number<double>("spawner density");
+        if (component.spawner_period <= 0.0f) in.error_at(line, "spawner period must be > 0");
+        component.spawner_entity = compile_entity(in, false);
+        if (component.spawner_entity != level_pack::kNone) {
+          const auto& spawned = pack.entities[component.spawner_entity];
+          spawn_templates.insert(pack.str(spawned.name));
+        }
+      } else {
+        in.error_at(line, "unknown component '" + comp + "' in " + name);
+      }
+      entity.components.push_back(std::move(component));
+    }
+    if (!closed && !in.failed()) {
+      in.error_at(start_line, "entity '" + name + "' is missing its closing '" + name + "'");
+    }
+    if (in.failed()) return level_pack::kNone;
+
+    const auto index = static_cast<uint32_t>(pack.entities.size());
+    pack.entities.push_back(std::move(entity));
+    return index;
+  }
+
+  void compile_entities(Tokens& in) {
+    while (!in.done() && !in.failed()) compile_entity(in, true);
+  }
+
+  void compile_levels(Tokens& in) {
+    std::set<std::string> ids;
+    level_pack::Level current{};
+    bool open = false;
+    const auto close = [&] {
+      if (open) pack.levels.push_back(std::move(current));
+      current = level_pack::Level{};
+      open = false;
+    };
+    while (!in.done() && !in.failed()) {
+      const int line = in.current_line();
+      const std::string token = in.word("level keyword");
+      if (token == "level") {
+        close();
+        const std::string id = in.word("level id");
+        if (!ids.insert(id).second) in.error_at(line, "duplicate level id '" + id + "'");
+        current.id = intern(id);
+        open = true;
+      } else if (token == "level_end") {
+        if (!open) in.error_at(line, "level_end without level");
+        close();
+      } else if (token == "recipe" || token == "spawn") {
+        if (!open) {
+          in.error_at(line, "'" + token + "' outside a level");
+          break;
+        }
+        if (token == "recipe") {
+          level_pack::RecipeEntry entry{};
+          entry.type = intern(in.word("recipe type"));
+          entry.count = in.number<int32_t>("recipe count");
+          if (entry.count <= 0) in.error_at(line, "recipe count must be > 0");
+          current.recipe.push_back(entry);
+        } else {
+          level_pack::Spawn spawn{};
+          spawn.type = intern(in.word("spawn type"));
+          const std::string template_name = in.word("spawn template");
+          spawn.template_name = intern(template_name);
+          spawn.period = in.number<float>("spawn period");
+          spawn.density = in.number<double>("spawn density");
+          spawn.total_to_spawn = in.number<int32_t>("spawn total");
+          if (!in.failed() && !spawn_templates.contains(template_name)) {
+            in.error_at(line, "spawn template '" + template_name +
+                                  "' is not a periodic_spawner entity in mushrooms.data");
+          }
+          if (spawn.period <= 0.0f) in.error_at(line, "spawn period must be > 0");
+          if (spawn.total_to_spawn < 0) in.error_at(line, "spawn total must be >= 0");
+          current.spawns.push_back(spawn);
+        }
+      } else {
+        in.error_at(line, "unknown keyword '" + token + "'");
+      }
+    }
+    close();
+    if (pack.levels.empty() && !in.failed()) in.error("no levels defined");
+  }
+
+  level_pack::Pack pack{};
+  std::set<std::string> spawn_templates{};
+
+ private:
+  std::unordered_map<std::string, uint32_t> string_index_{};
+};
+
+bool read_tokens(const std::string& path, std::vector<Tokens>& out) {
+  std::ifstream in(path);
+  if (!in.is_open()) {
+    std::cerr << "level_pack: cannot open " << path << std::endl;
+    return false;
+  }
+  out.emplace_back(path, in);
+  return true;
+}
+
+}  // namespace
+
+int main(int argc, char** argv) {
+  if (argc != 4) {
+    std::cerr << "usage: shrooms_level_pack <levels.data> <mushrooms.data> <output.pack>"
+              << std::endl;
+    return 2;
+  }
+  const std::string levels_path = argv[1];
+  const std::string mushrooms_path = argv[2];
+  const std::string output_path = argv[3];
+
+  std::vector<Tokens> sources;
+  if (!read_tokens(mushrooms_path, sources) || !read_tokens(levels_path, sources)) return 1;
+
+  // Entities first so level spawn plans can be checked against the spawn templates.
+  Compiler compiler{};
+  compiler.compile_entities(sources[0]);
+  if (sources[0].failed()) return 1;
+  compiler.compile_levels(sources[1]);
+  if (sources[1].failed()) return 1;
+
+  if (!level_pack::hash_sources(levels_path, mushrooms_path, compiler.pack.source_hash)) {
+    std::cerr << "level_pack: cannot hash " << levels_path << " and " << mushrooms_path
+              << std::endl;
+    return 1;
+  }
+  const std::vector<uint8_t> bytes = level_pack::encode(compiler.pack);
+  level_pack::Pack check{};
+  if (!level_pack::decode(bytes.data(), bytes.size(), check)) {
+    std::cerr << "level_pack: encoded pack does not decode" << std::endl;
+    return 1;
+  }
+
+  std::ifstream existing(output_path, std::ios::binary);
+  if (existing.is_open()) {
+    const std::vector<uint8_t> current((std::istreambuf_iterator<char>(existing)),
+                                       std::istreambuf_iterator<char>());
+    if (current == bytes) return 0;
+  }
+  existing.close();
+
+  std::ofstream out(output_path, std::ios::binary | std::ios::trunc);
+  if (!out.is_open()) {
+    std::cerr << "level_pack: cannot write " << output_path << std::endl;
+    return 1;
+  }
+  out.write(reinterpret_cast<const char*>(bytes.data()),
+            static_cast<std::streamsize>(bytes.size()));
+  std::cout << "level_pack: wrote " << bytes.size() << " bytes (" << compiler.pack.levels.size()
+            << " levels, " << compiler.pack.entities.size() << " entities) to " << output_path
+            << std::endl;
+  return 0;
+}
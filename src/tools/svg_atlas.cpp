@@ -0,0 +1,159 @@
+// Packs a list of shrooms SVGs into one atlas SVG plus a text manifest of cell rects.
+//
+//   shrooms_svg_atlas <svg_dir> <atlas_name> <sprite>...
+//
+// Writes <svg_dir>/<atlas_name>.svg and <svg_dir>/<atlas_name>.atlas. Cells are laid out in
+// reference units (the SVG viewBox units that texture_sizing::reference_size reports), so the
+// atlas rasterizes at the same density as the individual sprites.
+
+#include <algorithm>
+#include <cstdio>
+#include <fstream>
+#include <iostream>
+#include <regex>
+#include <sstream>
+#include <string>
+#include <vector>
+
+namespace {
+
+constexpr float kPaddingRef = 4.0f;
+constexpr float kMaxAtlasWidthRef = 256.0f;
+
+struct Sprite {
+  std::string name;
+  float min_x = 0.0f;
+  float min_y = 0.0f;
+  float width = 0.0f;
+  float height = 0.0f;
+  std::string style;
+  std::string body;
+  float x = 0.0f;
+  float y = 0.0f;
+};
+
+bool read_file(const std::string& path, std::string& out) {
+  std::ifstream in(path, std::ios::binary);
+  if (!in.is_open()) return false;
+  std::stringstream buffer;
+  buffer << in.rdbuf();
+  out = buffer.str();
+  return true;
+}
+
+std::string attribute(const std::string& tag, const std::string& key) {
+  const std::regex pattern("\\s" + key + "\\s*=\\s*\"([^\"]*)\"");
+  std::smatch match;
+  if (std::regex_search(tag, match, pattern)) return match[1].str();
+  return {};
+}
+
+// Ids are prefixed with the sprite name so defs from different files cannot collide.
+std::string prefix_ids(const std::string& body, const std::string& prefix) {
+  std::string out = std::regex_replace(body, std::regex("\\sid=\"([^\"]*)\""),
+                                       " id=\"" + prefix + "-$1\"");
+  out = std::regex_replace(out, std::regex("url\\(#([^)]*)\\)"), "url(#" + prefix + "-$1)");
+  out = std::regex_replace(out, std::regex("href=\"#([^\"]*)\""), "href=\"#" + prefix + "-$1\"");
+  return out;
+}
+
+bool load_sprite(const std::string& dir, const std::string& name, Sprite& sprite) {
+  std::string text;
+  if (!read_file(dir + "/" + name + ".svg", text)) {
+    std::cerr << "svg_atlas: missing " << name << ".svg" << std::endl;
+    return false;
+  }
+  const size_t open = text.find("<svg");
+  const size_t open_end = open == std::string::npos ? open : text.find('>', open);
+  const size_t close = text.rfind("</svg>");
+  if (open_end == std::string::npos || close == std::string::npos || close < open_end) {
+    std::cerr << "svg_atlas: malformed " << name << ".svg" << std::endl;
+    return false;
+  }
+  const std::string root = text.substr(open, open_end - open);
+  std::string view_box = attribute(root, "viewBox");
+  std::replace(view_box.begin(), view_box.end(), ',', ' ');
+  std::istringstream in(view_box);
+  if (!(in >> sprite.min_x >> sprite.min_y >> sprite.width >> sprite.height) ||
+      sprite.width <= 0.0f || sprite.height <= 0.0f) {
+    std::cerr << "svg_atlas: no viewBox in " << name << ".svg" << std::endl;
+    return false;
+  }
+  sprite.name = name;
+  sprite.style = attribute(root, "style");
+  sprite.body = prefix_ids(text.substr(open_end + 1, close - open_end - 1), name);
+  return true;
+}
+
+// Shelf packing, tallest first.
+void pack(std::vector<Sprite>& sprites, float& atlas_width, float& atlas_height) {
+  std::vector<Sprite*> order;
+  for (auto& sprite : sprites) order.push_back(&sprite);
+  std::stable_sort(order.begin(), order.end(),
+                   [](const Sprite* a, const Sprite* b) { return a->height > b->height; });
+
+  float cursor_x = kPaddingRef;
+  float cursor_y = kPaddingRef;
+  float shelf_height = 0.0f;
+  atlas_width = 0.0f;
+  for (auto* sprite : order) {
+    if (cursor_x > kPaddingRef && cursor_x + sprite->width + kPaddingRef > kMaxAtlasWidthRef) {
+      cursor_x = kPaddingRef;
+      cursor_y += shelf_height + kPaddingRef;
+      shelf_height = 0.0f;
+    }
+    sprite->x = cursor_x;
+    sprite->y = cursor_y;
+    cursor_x += sprite->width + kPaddingRef;
+    shelf_height = std::max(shelf_height, sprite->height);
+    atlas_width = std::max(atlas_width, cursor_x);
+  }
+  atlas_height = cursor_y + shelf_height + kPaddingRef;
+}
+
+}  // namespace
+
+int main(int argc, char** argv) {
+  if (argc < 4) {
+    std::cerr << "usage: shrooms_svg_atlas <svg_dir> <atlas_name> <sprite>..." << std::endl;
+    return 2;
+  }
+  const std::string dir = argv[1];
+  const std::string atlas_name = argv[2];
+
+  std::vector<Sprite> sprites;
+  for (int i = 3; i < argc; ++i) {
+    Sprite sprite{};
+    if (!load_sprite(dir, argv[i], sprite)) return 1;
+    sprites.push_back(std::move(sprite));
+  }
+
+  float width = 0.0f;
+  float height = 0.0f;
+  pack(sprites, width, height);
+
+  std::ofstream svg(dir + "/" + atlas_name + ".svg", std::ios::binary);
+  std::ofstream manifest(dir + "/" + atlas_name + ".atlas", std::ios::binary);
+  if (!svg.is_open() || !manifest.is_open()) {
+    std::cerr << "svg_atlas: cannot write " << atlas_name << std::endl;
+    return 1;
+  }
+
+  svg << "<?xml version=\"1.0\" encoding=\"UTF-8\" standalone=\"no\"?>\n"
+      << "<!-- Generated by shrooms_svg_atlas; do not edit. -->\n"
+      << "<svg version=\"1.1\" viewBox=\"0 0 " << width << " " << height << "\" width=\""
+      << width << "\" height=\"" << height
+      << "\" xmlns=\"http://www.w3.org/2000/svg\" "
+         "xmlns:xlink=\"http://www.w3.org/1999/xlink\">\n";
+  manifest << "size " << width << " " << height << "\n";
+  for (const auto& sprite : sprites) {
+    svg << "<g transform=\"translate(" << sprite.x - sprite.min_x << " "
+        << sprite.y - sprite.min_y << ")\"";
+    if (!sprite.style.empty()) svg << " style=\"" << sprite.style << "\"";
+    svg << ">\n" << sprite.body << "\n</g>\n";
+    manifest << sprite.name << " " << sprite.x << " " << sprite.y << " " << sprite.width << " "
+             << sprite.height << "\n";
+  }
+  svg << "</svg>\n";
+  return 0;
+}
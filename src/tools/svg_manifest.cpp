@@ -0,0 +1,130 @@
+// Scans the shrooms SVG directory and writes a constexpr metadata table (viewBox, aspect ratio,
+// file size, content hash) consumed by shrooms::texture_sizing and shrooms::raster_cache.
+//
+//   shrooms_svg_manifest_tool <svg_dir> <output_header>
+
+#include <algorithm>
+#include <cstdint>
+#include <filesystem>
+#include <fstream>
+#include <iostream>
+#include <regex>
+#include <sstream>
+#include <string>
+#include <vector>
+
+namespace {
+
+struct Entry {
+  std::string name;
+  float min_x = 0.0f;
+  float min_y = 0.0f;
+  float width = 0.0f;
+  float height = 0.0f;
+  uintmax_t file_size = 0;
+  uint32_t hash = 0;
+};
+
+// Must match shrooms::raster_cache::content_hash() and src/tools/svg_raster_cache.cpp.
+uint32_t content_hash(const std::string& text) {
+  uint32_t hash = 2166136261u;
+  for (char c : text) {
+    hash ^= static_cast<uint8_t>(c);
+    hash *= 16777619u;
+  }
+  return hash;
+}
+
+bool parse_viewbox(const std::string& svg, Entry& entry) {
+  std::smatch match;
+  if (!std::regex_search(svg, match, std::regex("viewBox\\s*=\\s*[\"']([^\"']*)[\"']"))) {
+    return false;
+  }
+  std::string value = match[1].str();
+  std::replace(value.begin(), value.end(), ',', ' ');
+  std::istringstream in(value);
+  return static_cast<bool>(in >> entry.min_x >> entry.min_y >> entry.width >> entry.height) &&
+         entry.width > 0.0f && entry.height > 0.0f;
+}
+
+std::string float_literal(float value) {
+  std::ostringstream out;
+  out << value;
+  std::string text = out.str();
+  if (text.find_first_of(".e") == std::string::npos) text += ".0";
+  return text + "f";
+}
+
+}  // namespace
+
+int main(int argc, char** argv) {
+  if (argc != 3) {
+    std::cerr << "usage: shrooms_svg_manifest_tool <svg_dir> <output_header>" << std::endl;
+    return 2;
+  }
+  namespace fs = std::filesystem;
+
+  std::vector<Entry> entries;
+  for (const auto& file : fs::directory_iterator(argv[1])) {
+    if (!file.is_regular_file() || file.path().extension() != ".svg") continue;
+    std::ifstream in(file.path(), std::ios::binary);
+    std::stringstream buffer;
+    buffer << in.rdbuf();
+    const std::string svg = buffer.str();
+
+    Entry entry{};
+    entry.name = file.path().stem().string();
+    if (!parse_viewbox(svg, entry)) {
+      std::cerr << "svg_manifest: skipping " << entry.name << ", no viewBox" << std::endl;
+      continue;
+    }
+    entry.file_size = file.file_size();
+    entry.hash = content_hash(svg);
+    entries.push_back(std::move(entry));
+  }
+  std::sort(entries.begin(), entries.end(),
+            [](const Entry& a, const Entry& b) { return a.name < b.name; });
+
+  std::ostringstream out;
+  out << "#pragma once\n\n"
+      << "// Generated by the shrooms_svg_manifest target (src/tools/svg_manifest.cpp); do not edit.\n\n"
+      << "#include <array>\n"
+      << "#include <cstdint>\n"
+      << "#include <string_view>\n\n"
+      << "namespace shrooms::svg_manifest {\n\n"
+      << "struct Entry {\n"
+      << "  std::string_view name;\n"
+      << "  float min_x;\n"
+      << "  float min_y;\n"
+      << "  float width;\n"
+      << "  float height;\n"
+      << "  float aspect;\n"
+      << "  uint32_t file_size;\n"
+      << "  uint32_t hash;\n"
+      << "};\n\n"
+      << "// Sorted by name.\n"
+      << "inline constexpr std::array<Entry, " << entries.size() << "> kEntries{{\n";
+  for (const auto& entry : entries) {
+    out << "    {\"" << entry.name << "\", " << float_literal(entry.min_x) << ", "
+        << float_literal(entry.min_y) << ", " << float_literal(entry.width) << ", "
+        << float_literal(entry.height) << ", " << float_literal(entry.width / entry.height)
+        << ", " << entry.file_size << "u, " << entry.hash << "u},\n";
+  }
+  out << "}};\n\n"
+      << "}  // namespace shrooms::svg_manifest\n";
+
+  // Leave the header untouched when nothing changed so dependent sources do not rebuild.
+  {
+    std::ifstream existing(argv[2], std::ios::binary);
+    std::stringstream current;
+    current << existing.rdbuf();
+    if (existing.is_open() && current.str() == out.str()) return 0;
+  }
+  std::ofstream file(argv[2], std::ios::binary);
+  if (!file.is_open()) {
+    std::cerr << "svg_manifest: cannot write " << argv[2] << std::endl;
+    return 1;
+  }
+  file << out.str();
+  return 0;
+}
@@ -0,0 +1,152 @@
+// Bakes shrooms SVGs to PNG with an external rasterizer and writes the index that
+// shrooms::raster_cache checks at startup.
+//
+//   shrooms_svg_raster_cache <svg_dir> <out_dir> <view_width> <rasterizer>
+//                            <sprite>[@min_ref_width]...
+//
+// Output goes to <out_dir>/<name>.png and <out_dir>/raster.index, which packaging lays over
+// assets/shrooms. Sprites that already have a checked-in <name>.png are skipped so the baked
+// copy never replaces a source PNG; sprites whose hash and width match the existing index are
+// not re-baked. <rasterizer> is invoked as `<rasterizer> -w <px> -o <png> <svg>` (rsvg-convert
+// syntax). Widths follow register_shrooms_svg_assets: viewBox width / 298 * view width.
+
+#include <algorithm>
+#include <cmath>
+#include <cstdint>
+#include <cstdlib>
+#include <filesystem>
+#include <fstream>
+#include <iostream>
+#include <regex>
+#include <sstream>
+#include <string>
+#include <unordered_map>
+
+namespace {
+
+constexpr float kReferenceCanvasWidthPx = 298.0f;
+
+// Must match shrooms::raster_cache::content_hash() and src/tools/svg_manifest.cpp.
+uint32_t content_hash(const std::string& text) {
+  uint32_t hash = 2166136261u;
+  for (char c : text) {
+    hash ^= static_cast<uint8_t>(c);
+    hash *= 16777619u;
+  }
+  return hash;
+}
+
+bool read_file(const std::string& path, std::string& out) {
+  std::ifstream in(path, std::ios::binary);
+  if (!in.is_open()) return false;
+  std::stringstream buffer;
+  buffer << in.rdbuf();
+  out = buffer.str();
+  return true;
+}
+
+float viewbox_width(const std::string& svg) {
+  std::smatch match;
+  if (!std::regex_search(svg, match, std::regex("viewBox\\s*=\\s*\"([^\"]*)\""))) return 0.0f;
+  std::string value = match[1].str();
+  std::replace(value.begin(), value.end(), ',', ' ');
+  std::istringstream in(value);
+  float min_x = 0.0f;
+  float min_y = 0.0f;
+  float width = 0.0f;
+  in >> min_x >> min_y >> width;
+  return width;
+}
+
+struct Baked {
+  uint32_t hash = 0;
+  int width_px = 0;
+};
+
+std::unordered_map<std::string, Baked> read_index(const std::string& path) {
+  std::unordered_map<std::string, Baked> entries;
+  std::ifstream in(path);
+  std::string name;
+  Baked baked{};
+  while (in >> name >> baked.hash >> baked.width_px) entries[name] = baked;
+  return entries;
+}
+
+}  // namespace
+
+int main(int argc, char** argv) {
+  if (argc < 6) {
+    std::cerr << "usage: shrooms_svg_raster_cache <svg_dir> <out_dir> <view_width> <rasterizer> "
+                 "<sprite>[@min_ref_width]..."
+              << std::endl;
+    return 2;
+  }
+  const std::string dir = argv[1];
+  const std::string out_dir = argv[2];
+  const float view_width = std::strtof(argv[3], nullptr);
+  const std::string rasterizer = argv[4];
+
+  std::error_code error;
+  std::filesystem::create_directories(out_dir, error);
+  const std::string index_path = out_dir + "/raster.index";
+  const auto previous = read_index(index_path);
+  std::ostringstream index;
+
+  int failures = 0;
+  for (int i = 5; i < argc; ++i) {
+    std::string name = argv[i];
+    float min_ref_width = 0.0f;
+    if (const size_t at = name.find('@'); at != std::string::npos) {
+      min_ref_width = std::strtof(name.c_str() + at + 1, nullptr);
+      name.resize(at);
+    }
+
+    if (std::filesystem::exists(dir + "/" + name + ".png")) {
+      std::cerr << "svg_raster_cache: skipping " << name << ", " << name
+                << ".png is a source asset" << std::endl;
+      continue;
+    }
+
+    const std::string svg_path = dir + "/" + name + ".svg";
+    std::string svg;
+    if (!read_file(svg_path, svg)) {
+      std::cerr << "svg_raster_cache: missing " << svg_path << std::endl;
+      ++failures;
+      continue;
+    }
+    const float ref_width = std::max(viewbox_width(svg), min_ref_width);
+    const int width_px =
+        static_cast<int>(std::lround(ref_width / kReferenceCanvasWidthPx * view_width));
+    if (width_px <= 0) {
+      std::cerr << "svg_raster_cache: no viewBox in " << svg_path << std::endl;
+      ++failures;
+      continue;
+    }
+
+    const uint32_t hash = content_hash(svg);
+    const std::string png_path = out_dir + "/" + name + ".png";
+    const auto it = previous.find(name);
+    const bool current = it != previous.end() && it->second.hash == hash &&
+                         it->second.width_px == width_px && std::filesystem::exists(png_path);
+    const std::string command = "\"" + rasterizer + "\" -w " + std::to_string(width_px) +
+                                " -o \"" + png_path + "\" \"" + svg_path + "\"";
+    if (!current && std::system(command.c_str()) != 0) {
+      std::cerr << "svg_raster_cache: rasterizer failed for " << name << std::endl;
+      ++failures;
+      continue;
+    }
+    index << name << " " << hash << " " << width_px << "\n";
+  }
+
+  // Rewritten only on change so packaging steps that copy the cache stay incremental.
+  std::string existing;
+  if (!read_file(index_path, existing) || existing != index.str()) {
+    std::ofstream out(index_path, std::ios::binary | std::ios::trunc);
+    if (!out.is_open()) {
+      std::cerr << "svg_raster_cache: cannot write " << index_path << std::endl;
+      return 1;
+    }
+    out << index.str();
+  }
+  return failures == 0 ? 0 : 1;
+}